@@ -592,7 +592,7 @@ void BaseView::draw()
 			std::vector<Position> drawnPositions;
 			for (const auto &p : fac->getRules()->getCraftSlots())
 			{			
-				while((craftIt != _base->getCrafts()->end()) && (((*craftIt)->getStatus() == "STR_OUT") ||  (*craftIt)->getIsAssignedToSlot() || (fac->getRules()->getHangarType() !=  (*craftIt)->getRules()->getHangarType())))
+				while((craftIt != _base->getCrafts()->end()) && (((*craftIt)->getStatus() == Craft::STATUS_OUT) ||  (*craftIt)->getIsAssignedToSlot() || (fac->getRules()->getHangarType() !=  (*craftIt)->getRules()->getHangarType())))
 						++craftIt;	
 				if ((craftIt != _base->getCrafts()->end()) && std::find(drawnPositions.begin(), drawnPositions.end(), p) == drawnPositions.end()) 
 				{
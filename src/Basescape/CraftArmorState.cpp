@@ -464,7 +464,7 @@ void CraftArmorState::lstSoldiersClick(Action *action)
 	}
 
 	Soldier *s = _base->getSoldiers()->at(_lstSoldiers->getSelectedRow());
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == Craft::STATUS_OUT))
 	{
 		if (_game->isLeftClick(action, true))
 		{
@@ -607,7 +607,7 @@ void CraftArmorState::btnDeequipAllArmorClick(Action *action)
 	int row = 0;
 	for (auto* soldier : *_base->getSoldiers())
 	{
-		if (!(soldier->getCraft() && soldier->getCraft()->getStatus() == "STR_OUT"))
+		if (!(soldier->getCraft() && soldier->getCraft()->getStatus() == Craft::STATUS_OUT))
 		{
 			Armor *a = soldier->getRules()->getDefaultArmor();
 
@@ -537,7 +537,7 @@ void CraftSoldiersState::lstSoldiersClick(Action *action)
 			_lstSoldiers->setCellText(row, 2, tr("STR_NONE_UC"));
 			_lstSoldiers->setRowColor(row, _lstSoldiers->getColor());
 		}
-		else if (s->getCraft() && s->getCraft()->getStatus() == "STR_OUT")
+		else if (s->getCraft() && s->getCraft()->getStatus() == Craft::STATUS_OUT)
 		{
 			// nothing
 		}
@@ -620,7 +620,7 @@ void CraftSoldiersState::btnDeassignAllSoldiersClick(Action *action)
 	int row = 0;
 	for (auto* soldier : *_base->getSoldiers())
 	{
-		if (soldier->getCraft() && soldier->getCraft()->getStatus() != "STR_OUT")
+		if (soldier->getCraft() && soldier->getCraft()->getStatus() != Craft::STATUS_OUT)
 		{
 			soldier->setCraftAndMoveEquipment(0, _base, _game->getSavedGame()->getMonthsPassed() == -1);
 			_lstSoldiers->setCellText(row, 2, tr("STR_NONE_UC"));
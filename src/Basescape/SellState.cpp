@@ -207,7 +207,7 @@ void SellState::delayedInit()
 	for (auto* craft : *_base->getCrafts())
 	{
 		if (_debriefingState) break;
-		if (craft->getStatus() != "STR_OUT")
+		if (craft->getStatus() != Craft::STATUS_OUT)
 		{
 			TransferRow row = { TRANSFER_CRAFT, craft, craft->getName(_game->getLanguage()), craft->getRules()->getSellCost(), 1, 0, 0, -3, 0, 0, craft->getRules()->getSellCost() };
 			_items.push_back(row);
@@ -393,7 +393,7 @@ void SoldiersState::initList(size_t scrl)
 			for (auto* soldier : *_base->getSoldiers())
 			{
 				idx++;
-				if ((soldier->getCraft() && soldier->getCraft()->getStatus() == "STR_OUT") || 
+				if ((soldier->getCraft() && soldier->getCraft()->getStatus() == Craft::STATUS_OUT) || 
                   
 				    ((selectedCraftIndex  > 1) && soldier->getCraft() != _base->getCrafts()->at(selectedCraftIndex-2)) ||
 					
@@ -163,7 +163,7 @@ TransferItemsState::TransferItemsState(Base *baseFrom, Base *baseTo, DebriefingS
 	for (auto* craft : *_baseFrom->getCrafts())
 	{
 		if (_debriefingState) break;
-		if (craft->getStatus() != "STR_OUT" || (Options::canTransferCraftsWhileAirborne && craft->getFuel() >= craft->getFuelLimit(_baseTo)))
+		if (craft->getStatus() != Craft::STATUS_OUT || (Options::canTransferCraftsWhileAirborne && craft->getFuel() >= craft->getFuelLimit(_baseTo)))
 		{
 			TransferRow row = { TRANSFER_CRAFT, craft, craft->getName(_game->getLanguage()),  (int)(25 * _distance), 1, 0, 0, -3, 0, 0, (int)(25 * _distance) };
 			_items.push_back(row);
@@ -571,7 +571,7 @@ void TransferItemsState::completeTransfer()
 							soldier->setReturnToTrainingWhenHealed(true);
 						}
 						soldier->setTraining(false);
-						if (craft->getStatus() == "STR_OUT")
+						if (craft->getStatus() == Craft::STATUS_OUT)
 						{
 							_baseTo->getSoldiers()->push_back(soldier);
 						}
@@ -591,7 +591,7 @@ void TransferItemsState::completeTransfer()
 
 				// Transfer craft
 				_baseFrom->removeCraft(craft, false);
-				if (craft->getStatus() == "STR_OUT")
+				if (craft->getStatus() == Craft::STATUS_OUT)
 				{
 					bool returning = (craft->getDestination() == (Target*)craft->getBase());
 					_baseTo->getCrafts()->push_back(craft);
@@ -944,7 +944,7 @@ void TransferItemsState::increaseByValue(int change)
 			_pQty += craft->getNumTotalSoldiers();
 			_iQty += craft->getTotalItemStorageSize();
 			getRow().amount++;
-			if (!Options::canTransferCraftsWhileAirborne || craft->getStatus() != "STR_OUT")
+			if (!Options::canTransferCraftsWhileAirborne || craft->getStatus() != Craft::STATUS_OUT)
 				_total += getRow().cost;
 			break;
 		case TRANSFER_ITEM:
@@ -1029,7 +1029,7 @@ void TransferItemsState::decreaseByValue(int change)
 		break;
 	}
 	getRow().amount -= change;
-	if (!Options::canTransferCraftsWhileAirborne || 0 == craft || craft->getStatus() != "STR_OUT")
+	if (!Options::canTransferCraftsWhileAirborne || 0 == craft || craft->getStatus() != Craft::STATUS_OUT)
 		_total -= getRow().cost * change;
 	updateItemStrings();
 }
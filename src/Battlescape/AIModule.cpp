@@ -6710,13 +6710,9 @@ std::map<Position, int, PositionComparator> AIModule::getReachableBy(BattleUnit*
 std::map<Position, int, PositionComparator> AIModule::getSmokeFearMap()
 {
 	std::map<Position, int, PositionComparator> smokeFearMap;
-	for (int i = 0; i < _save->getMapSizeXYZ(); i++)
+	for (auto* tile : _save->getTilesWithSmoke())
 	{
-		Tile* tile = _save->getTile(i);
-		if (tile && tile->getSmoke() > 0)
-		{
-			smokeFearMap[tile->getPosition()] = tile->getSmoke();
-		}
+		smokeFearMap[tile->getPosition()] = tile->getSmoke();
 	}
 	return smokeFearMap;
 }
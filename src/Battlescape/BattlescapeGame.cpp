@@ -2522,6 +2522,7 @@ void BattlescapeGame::removeSummonedPlayerUnits()
 				_save->removeItem(bi);
 			}
 
+			bu->clearVisibleTiles();
 			bu->setTile(nullptr, _save);
 			_save->clearUnitSelection(bu);
 			delete bu;
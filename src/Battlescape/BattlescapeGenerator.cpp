@@ -1073,7 +1073,7 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 		for (auto* soldier : *_base->getSoldiers())
 		{
 			if ((_craft != 0 && soldier->getCraft() == _craft) ||
-				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != "STR_OUT")))
+				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != Craft::STATUS_OUT)))
 			{
 				Armor* transformedArmor = nullptr;
 				if (enviro)
@@ -1115,7 +1115,7 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 				continue;
 			}
 			if ((_craft != 0 && soldier->getCraft() == _craft) ||
-				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != "STR_OUT")))
+				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != Craft::STATUS_OUT)))
 			{
 				// clear the soldier's equipment layout, we want to start fresh
 				if (_game->getSavedGame()->getDisableSoldierEquipment())
@@ -1176,7 +1176,7 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 				continue;
 			}
 			if ((_craft != 0 && soldier->getCraft() == _craft) ||
-				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != "STR_OUT")))
+				(_craft == 0 && (soldier->hasFullHealth() || soldier->canDefendBase()) && (soldier->getCraft() == 0 || soldier->getCraft()->getStatus() != Craft::STATUS_OUT)))
 			{
 				// clear the soldier's equipment layout, we want to start fresh
 				if (_game->getSavedGame()->getDisableSoldierEquipment())
@@ -1292,7 +1292,7 @@ void BattlescapeGenerator::deployXCOM(const RuleStartingCondition* startingCondi
 		// add items from crafts in base
 		for (auto* craft : *_base->getCrafts())
 		{
-			if (craft->getStatus() == "STR_OUT")
+			if (craft->getStatus() == Craft::STATUS_OUT)
 				continue;
 			for (const auto& pair : *craft->getItems()->getContents())
 			{
@@ -2170,7 +2170,7 @@ void DebriefingState::prepareDebriefing()
 			// reequip crafts (only those on the base) after a base defense mission
 			for (auto* xcraft : *base->getCrafts())
 			{
-				if (xcraft->getStatus() != "STR_OUT")
+				if (xcraft->getStatus() != Craft::STATUS_OUT)
 					reequipCraft(base, xcraft, false);
 			}
 		}
@@ -86,7 +86,7 @@ InventoryState::InventoryState(bool tu, BattlescapeState *parent, Base *base, bo
 		for (auto* soldier : *_base->getSoldiers())
 		{
 			_backup[soldier] = soldier->getCraft();
-			if (soldier->getCraft() && soldier->getCraft()->getStatus() != "STR_OUT")
+			if (soldier->getCraft() && soldier->getCraft()->getStatus() != Craft::STATUS_OUT)
 			{
 				soldier->setCraftAndMoveEquipment(0, _base, _game->getSavedGame()->getMonthsPassed() == -1);
 			}
@@ -811,7 +811,7 @@ void InventoryState::btnArmorClick(Action *action)
 	BattleUnit *unit = _battleGame->getSelectedUnit();
 	Soldier *s = unit->getGeoscapeSoldier();
 
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == Craft::STATUS_OUT))
 	{
 		size_t soldierIndex = 0;
 		for (auto soldierIt = _base->getSoldiers()->begin(); soldierIt != _base->getSoldiers()->end(); ++soldierIt)
@@ -849,7 +849,7 @@ void InventoryState::btnArmorClickRight(Action *action)
 	BattleUnit *unit = _battleGame->getSelectedUnit();
 	Soldier *s = unit->getGeoscapeSoldier();
 
-	if (!(s->getCraft() && s->getCraft()->getStatus() == "STR_OUT"))
+	if (!(s->getCraft() && s->getCraft()->getStatus() == Craft::STATUS_OUT))
 	{
 		size_t soldierIndex = 0;
 		for (auto soldierIt = _base->getSoldiers()->begin(); soldierIt != _base->getSoldiers()->end(); ++soldierIt)
@@ -1153,7 +1153,7 @@ void InventoryState::btnOkClick(Action *)
 			for (auto* soldier : *_base->getSoldiers())
 			{
 				Craft* c = _backup[soldier];
-				if (!soldier->getCraft() && c && c->getStatus() != "STR_OUT")
+				if (!soldier->getCraft() && c && c->getStatus() != Craft::STATUS_OUT)
 				{
 					int space = c->getSpaceAvailable();
 					if (c->validateAddingSoldier(space, soldier) == CPE_None)
@@ -2054,7 +2054,7 @@ void InventoryState::onMoveGroundInventoryToBase(Action *)
 	Soldier *s = unit->getGeoscapeSoldier();
 	Craft *c = s->getCraft();
 
-	if (c == 0 || c->getStatus() == "STR_OUT")
+	if (c == 0 || c->getStatus() == Craft::STATUS_OUT)
 	{
 		// we're either not in a craft or not in a hangar (should not happen, but just in case)
 		return;
@@ -19,6 +19,7 @@
 #include "Map.h"
 #include "Camera.h"
 #include "UnitSprite.h"
+#include "MiniMapView.h"
 #include "ItemSprite.h"
 #include "Pathfinding.h"
 #include "TileEngine.h"
@@ -30,6 +31,7 @@
 #include "../Engine/Action.h"
 #include "../Engine/SurfaceSet.h"
 #include "../Engine/Timer.h"
+#include "../Engine/FrameProfiler.h"
 #include "../Engine/Language.h"
 #include "../Engine/Palette.h"
 #include "../Engine/Game.h"
@@ -170,6 +172,9 @@ Map::Map(Game *game, int width, int height, int x, int y, int visibleMapHeight)
 	_cacheAccuracy = -1;
 
 	_thisTileVisible = false;
+	_terrainLayerNvColor = 0;
+	_unitSpriteCache = new UnitSpriteCache();
+	_miniMapCache = new MiniMapCache();
 	_nightVisionOn = false;
 	if (Options::oxceToggleNightVisionType == 2)
 	{
@@ -237,6 +242,8 @@ Map::~Map()
 	delete _message;
 	delete _camera;
 	delete _txtAccuracy;
+	delete _unitSpriteCache;
+	delete _miniMapCache;
 }
 
 /**
@@ -296,6 +303,7 @@ void Map::draw()
 	{
 		return;
 	}
+	FrameProfiler::Scope profile(FrameProfiler::PROFILE_MAP);
 
 	// normally we'd call for a Surface::draw();
 	// but we don't want to clear the background with colour 0, which is transparent (aka black)
@@ -719,6 +727,105 @@ void Map::drawUnit(UnitSprite &unitSprite, Tile *unitTile, Tile *currTile, Posit
 	unitSprite.draw(bu, part, tileScreenPosition.x + offsets.ScreenOffset.x, tileScreenPosition.y + offsets.ScreenOffset.y, shade, mask, _isAltPressed && !_isCtrlPressed);
 }
 
+/**
+ * Calculates the shades a tile is drawn with and sets up the fog of war state for it.
+ * @param tile The tile to draw.
+ * @param colorBeforeFoW Night vision color to restore for tiles outside of the fog of war.
+ * @param tileShade Shade of the tile.
+ * @param obstacleShade Shade of the tile's obstacles.
+ * @param oxceFOWshade Extra shade of tiles in the fog of war.
+ */
+void Map::calculateTileShade(Tile *tile, int colorBeforeFoW, int &tileShade, int &obstacleShade, int &oxceFOWshade)
+{
+	oxceFOWshade = 0; // needs to be zero if FOW is off
+	if (Options::oxceFOW > 0)
+	{
+		oxceFOWshade = 4;
+		if (Options::oxceFOW == 1)
+		{
+			if (tile->getLastExplored(FACTION_PLAYER) == _save->getTurn())
+				_thisTileVisible = true;
+			else
+				_thisTileVisible = false;
+		}
+		else
+			_thisTileVisible = _save->isTileVisible(tile);
+		if (_thisTileVisible)
+		{
+			tileShade = reShade(tile);
+			_nvColor = colorBeforeFoW; // reset if previous tile was FOW
+			obstacleShade = tileShade;
+			if (_showObstacles)
+			{
+				if (tile->isObstacle())
+				{
+					obstacleShade = getShadePulseForFrame(tileShade, _animFrame);
+				}
+			}
+		}
+		else if (tile->isDiscovered(O_FLOOR))
+		{
+			tileShade = reShade(tile) + oxceFOWshade; // make non visible tiles darker
+			_nvColor = Options::oxceFOWColor;        // set FOW color
+			if (tileShade > 15)
+				tileShade = 15;
+			obstacleShade = tileShade;
+			if (_showObstacles)
+				if (tile->isObstacle())
+					obstacleShade = getShadePulseForFrame(tileShade, _animFrame) + oxceFOWshade;
+		}
+		else
+		{
+			_nvColor = colorBeforeFoW; // reset if previous tile was FOW... just in case
+			tileShade = 16;
+			obstacleShade = 16;
+		}
+	}
+	else // No Fog of War - normal shade behavior below -
+	{
+		if (tile->isDiscovered(O_FLOOR))
+		{
+			tileShade = reShade(tile);
+			obstacleShade = tileShade;
+			if (_showObstacles)
+			{
+				if (tile->isObstacle())
+				{
+					obstacleShade = getShadePulseForFrame(tileShade, _animFrame);
+				}
+			}
+		}
+		else
+		{
+			tileShade = 16;
+			obstacleShade = 16;
+		}
+	}
+}
+
+/**
+ * Gets the shade a terrain part of a tile is drawn with.
+ * @param tile The tile to draw.
+ * @param part The part to draw.
+ * @param tileShade Shade of the tile.
+ * @param obstacleShade Shade of the tile's obstacles.
+ * @param oxceFOWshade Extra shade of tiles in the fog of war.
+ * @return Shade of the part.
+ */
+int Map::getTerrainPartShade(Tile *tile, TilePart part, int tileShade, int obstacleShade, int oxceFOWshade)
+{
+	if (tile->getObstacle(part))
+	{
+		return obstacleShade;
+	}
+	if (part == O_WESTWALL || part == O_NORTHWALL)
+	{
+		auto wallShade = getWallShade(part, tile);
+		return _thisTileVisible ? wallShade : wallShade + oxceFOWshade;
+	}
+	return tileShade;
+}
+
 /**
  * Draw the terrain.
  * Keep this function as optimised as possible. It's big to minimise overhead of function calls.
@@ -726,9 +833,6 @@ void Map::drawUnit(UnitSprite &unitSprite, Tile *unitTile, Tile *currTile, Posit
  */
 void Map::drawTerrain(Surface *surface)
 {
-	if (Options::oxceFOW)
-		_save->updateVisibleTiles();
-
 	_isAltPressed = _game->isAltPressed(true);
 	_isCtrlPressed = _game->isCtrlPressed(true);
 	int frameNumber = 0;
@@ -743,7 +847,7 @@ void Map::drawTerrain(Surface *surface)
 	BattleUnit *movingUnit = _save->getTileEngine()->getMovingUnit();
 	int tileShade, tileColor, obstacleShade;
 	UnitSprite unitSprite(surface, _game->getMod(), _save, _animFrame, _save->getDepth() != 0,
-		_isTFTD ? ArrowColorsTFTD[1] : ArrowColorsUFO[1], _isTFTD ? ArrowColorsTFTD[2] : ArrowColorsUFO[2]);
+		_isTFTD ? ArrowColorsTFTD[1] : ArrowColorsUFO[1], _isTFTD ? ArrowColorsTFTD[2] : ArrowColorsUFO[2], _unitSpriteCache);
 	ItemSprite itemSprite(surface, _game->getMod(), _save, _animFrame);
 	int colorBeforeFoW = _nvColor;
 
@@ -882,18 +986,18 @@ void Map::drawTerrain(Surface *surface)
 	if (movingUnit)
 	{
 		movingUnitPosition = movingUnit->getPosition();
-
-		//Update FOW if player unit moving
-		if (Options::oxceFOW)
-			if (movingUnit->getFaction() == FACTION_PLAYER)
-				_save->updateVisibleTiles();
 	}
 
+	// static terrain is drawn from pre-rendered layers, unless there is something on the map that isn't bound to a single tile
+	const bool useTerrainLayers = !_projectile && _waypoints.empty() &&
+		std::all_of(_vaporParticles.begin(), _vaporParticles.end(), [](const std::vector<Particle>& v){ return v.empty(); });
+
 	surface->lock();
 	const auto cameraPos = _camera->getMapOffset();
 	for (int itZ = beginZ; itZ <= endZ; itZ++)
 	{
 		bool topLayer = itZ == endZ;
+		const bool useLayer = useTerrainLayers && prepareTerrainLayer(surface, itZ, beginX, endX, beginY, endY, movingUnit, colorBeforeFoW);
 		for (int itY = beginY; itY < endY; itY++)
 		{
 			mapPosition = Position(beginX, itY, itZ);
@@ -907,73 +1011,21 @@ void Map::drawTerrain(Surface *surface)
 				if (screenPosition.x > -_spriteWidth && screenPosition.x < surface->getWidth() + _spriteWidth &&
 					screenPosition.y > -_spriteHeight && screenPosition.y < surface->getHeight() + _spriteHeight )
 				{
-					auto isUnitMovingNearby = movingUnit && positionInRangeXY(movingUnitPosition, mapPosition, 2);
-
-
-					int oxceFOWshade = 0; // needs to be zero if FOW is off
-					if (Options::oxceFOW > 0)
+					if (useLayer)
 					{
-						oxceFOWshade = 4;
-						if (Options::oxceFOW == 1)
+						// only tiles overlapping something dynamic are drawn over the pre-rendered terrain
+						const auto& layerTile = _terrainLayerTiles[(itY - beginY) * (endX - beginX) + (itX - beginX)];
+						if (!layerTile.redraw)
 						{
-							if (tile->getLastExplored(FACTION_PLAYER) == _save->getTurn())
-								_thisTileVisible = true;
-							else
-								_thisTileVisible = false;
-						}
-						else
-							_thisTileVisible = _save->isTileVisible(tile);
-						if (_thisTileVisible)
-						{
-							tileShade = reShade(tile);
-							_nvColor = colorBeforeFoW; // reset if previous tile was FOW
-							obstacleShade = tileShade;
-							if (_showObstacles)
-							{
-								if (tile->isObstacle())
-								{
-									obstacleShade = getShadePulseForFrame(tileShade, _animFrame);
-								}
-							}
-						}
-						else if (tile->isDiscovered(O_FLOOR))
-						{
-							tileShade = reShade(tile) + oxceFOWshade; // make non visible tiles darker
-							_nvColor = Options::oxceFOWColor;        // set FOW color
-							if (tileShade > 15)
-								tileShade = 15;
-							obstacleShade = tileShade;
-							if (_showObstacles)
-								if (tile->isObstacle())
-									obstacleShade = getShadePulseForFrame(tileShade, _animFrame) + oxceFOWshade;
-						}
-						else
-						{
-							_nvColor = colorBeforeFoW; // reset if previous tile was FOW... just in case
-							tileShade = 16;
-							obstacleShade = 16;
+							continue;
 						}
+						_nvColor = layerTile.nvColor;
 					}
-					else // No Fog of War - normal shade behavior below -
-					{
-						if (tile->isDiscovered(O_FLOOR))
-						{
-							tileShade = reShade(tile);
-							obstacleShade = tileShade;
-							if (_showObstacles)
-							{
-								if (tile->isObstacle())
-								{
-									obstacleShade = getShadePulseForFrame(tileShade, _animFrame);
-								}
-							}
-						}
-						else
-						{
-							tileShade = 16;
-							obstacleShade = 16;
-						}
-					} 
+					auto isUnitMovingNearby = movingUnit && positionInRangeXY(movingUnitPosition, mapPosition, 2);
+
+
+					int oxceFOWshade;
+					calculateTileShade(tile, colorBeforeFoW, tileShade, obstacleShade, oxceFOWshade);
 					tileColor = tile->getMarkerColor();
 								
 
@@ -982,10 +1034,7 @@ void Map::drawTerrain(Surface *surface)
 					tmpSurface = tile->getSprite(O_FLOOR);
 					if (tmpSurface)
 					{
-						if (tile->getObstacle(O_FLOOR))
-							Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_FLOOR), obstacleShade, false, _nvColor);
-						else
-							Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_FLOOR), tileShade, false, _nvColor);
+						Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_FLOOR), getTerrainPartShade(tile, O_FLOOR, tileShade, obstacleShade, oxceFOWshade), false, _nvColor);
 					}
 
 					auto unit = tile->getUnit();
@@ -1042,25 +1091,13 @@ void Map::drawTerrain(Surface *surface)
 						tmpSurface = tile->getSprite(O_WESTWALL);
 						if (tmpSurface)
 						{
-							auto wallShade = getWallShade(O_WESTWALL, tile);
-							if (tile->getObstacle(O_WESTWALL))
-								Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_WESTWALL), obstacleShade, false, _nvColor);
-							else if (_thisTileVisible)
-								Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_WESTWALL), wallShade, false, _nvColor);
-							else
-								Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_WESTWALL), wallShade + oxceFOWshade, false, _nvColor);
+							Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_WESTWALL), getTerrainPartShade(tile, O_WESTWALL, tileShade, obstacleShade, oxceFOWshade), false, _nvColor);
 						}
 						// Draw north wall
 						tmpSurface = tile->getSprite(O_NORTHWALL);
 						if (tmpSurface)
 						{
-							auto wallShade = getWallShade(O_NORTHWALL, tile);
-							if (tile->getObstacle(O_NORTHWALL))
-								Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_NORTHWALL), obstacleShade, bool(tile->getSprite(O_WESTWALL)), _nvColor);
-							else if (_thisTileVisible)
-								Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_NORTHWALL), wallShade, bool(tile->getSprite(O_WESTWALL)), _nvColor);
-							else
-								Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_NORTHWALL), wallShade + oxceFOWshade, bool(tile->getSprite(O_WESTWALL)), _nvColor);
+							Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_NORTHWALL), getTerrainPartShade(tile, O_NORTHWALL, tileShade, obstacleShade, oxceFOWshade), bool(tile->getSprite(O_WESTWALL)), _nvColor);
 						}
 						// Draw object
 						tmpSurface = tile->getSprite(O_OBJECT);
@@ -1068,10 +1105,7 @@ void Map::drawTerrain(Surface *surface)
 						{
 							if (tile->isBackTileObject(O_OBJECT))
 							{
-								if (tile->getObstacle(O_OBJECT))
-									Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_OBJECT), obstacleShade, false, _nvColor);
-								else
-									Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_OBJECT), tileShade, false, _nvColor);
+								Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_OBJECT), getTerrainPartShade(tile, O_OBJECT, tileShade, obstacleShade, oxceFOWshade), false, _nvColor);
 							}
 						}
 						// draw an item on top of the floor (if any)
@@ -1345,10 +1379,7 @@ void Map::drawTerrain(Surface *surface)
 						{
 							if (!tile->isBackTileObject(O_OBJECT))
 							{
-								if (tile->getObstacle(O_OBJECT))
-									Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_OBJECT), obstacleShade, false, _nvColor);
-								else
-									Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_OBJECT), tileShade, false, _nvColor);
+								Surface::blitRaw(surface, tmpSurface, screenPosition.x, screenPosition.y - tile->getYOffset(O_OBJECT), getTerrainPartShade(tile, O_OBJECT, tileShade, obstacleShade, oxceFOWshade), false, _nvColor);
 							}
 						}
 					}
@@ -1921,6 +1952,10 @@ void Map::drawTerrain(Surface *surface)
 				}
 			}
 		}
+		if (useLayer)
+		{
+			compositeTerrainLayer(surface, itZ);
+		}
 	}
 	_nvColor = colorBeforeFoW;
 	if (pathfinderTurnedOn)
@@ -2168,6 +2203,254 @@ void Map::drawTerrain(Surface *surface)
 	surface->unlock();
 }
 
+namespace
+{
+
+/**
+ * Gets smallest area that contains both areas.
+ */
+GraphSubset uniteAreas(const GraphSubset& a, const GraphSubset& b)
+{
+	if (!a)
+	{
+		return b;
+	}
+	if (!b)
+	{
+		return a;
+	}
+	GraphSubset ret = a;
+	ret.beg_x = std::min(a.beg_x, b.beg_x);
+	ret.end_x = std::max(a.end_x, b.end_x);
+	ret.beg_y = std::min(a.beg_y, b.beg_y);
+	ret.end_y = std::max(a.end_y, b.end_y);
+	return ret;
+}
+
+} //namespace
+
+/**
+ * Prepares drawing of a map level from its pre-rendered static terrain.
+ * Tiles that have nothing but terrain on them are described by a list of blits. When that list is
+ * the same as the one the layer was rendered from, the layer is used and only the tiles overlapping
+ * something dynamic (units, items, smoke, cursor, animated terrain...) need to be drawn, see compositeTerrainLayer.
+ * The layer is rendered when the list didn't change since the previous frame, so scrolling
+ * or changes in lighting fall back to drawing every tile instead of rebuilding layers each frame.
+ * @param surface The surface to draw on.
+ * @param itZ The map level.
+ * @param beginX First column of tiles to draw.
+ * @param endX End of the columns of tiles to draw.
+ * @param beginY First row of tiles to draw.
+ * @param endY End of the rows of tiles to draw.
+ * @param movingUnit The unit that is moving, if any.
+ * @param colorBeforeFoW Night vision color to restore for tiles outside of the fog of war.
+ * @return True if the layer is used and only tiles flagged for redraw should be drawn.
+ */
+bool Map::prepareTerrainLayer(Surface *surface, int itZ, int beginX, int endX, int beginY, int endY, BattleUnit *movingUnit, int colorBeforeFoW)
+{
+	if ((int)_terrainLayers.size() != _save->getMapSizeZ())
+	{
+		_terrainLayers.clear();
+		_terrainLayers.resize(_save->getMapSizeZ());
+	}
+	TerrainLayer &layer = _terrainLayers[itZ];
+	const int width = surface->getWidth();
+	const int height = surface->getHeight();
+	const int sizeX = std::max(endX - beginX, 0);
+	const int sizeY = std::max(endY - beginY, 0);
+
+	_terrainLayerTiles.clear();
+	_terrainLayerTiles.resize(sizeX * sizeY);
+	_terrainLayerBlits.clear();
+	_terrainLayerDirty.clear();
+
+	// tile shades depend on the fog of war state left by the previous tile, so tiles are walked in drawing order
+	const int nvColorBefore = _nvColor;
+	const bool thisTileVisibleBefore = _thisTileVisible;
+	const bool cursorVisible = _cursorType != CT_NONE && !_save->getBattleState()->getMouseOverIcons();
+	const Position movingUnitPosition = movingUnit ? movingUnit->getPosition() : Position();
+	const GraphSubset dynamicArea = GraphSubset(3 * _spriteWidth, 3 * _spriteHeight).offset(-_spriteWidth, -_spriteHeight);
+	const auto cameraPos = _camera->getMapOffset();
+	bool usable = true;
+	Position mapPosition, screenPosition;
+
+	for (int itY = beginY; itY < endY; itY++)
+	{
+		mapPosition = Position(beginX, itY, itZ);
+		Tile *tile = _save->getTile(mapPosition);
+		for (int itX = beginX; itX < endX; itX++, mapPosition.x++, tile++)
+		{
+			_camera->convertMapToScreen(mapPosition, &screenPosition);
+			screenPosition += cameraPos;
+
+			// only render cells that are inside the surface
+			if (screenPosition.x > -_spriteWidth && screenPosition.x < width + _spriteWidth &&
+				screenPosition.y > -_spriteHeight && screenPosition.y < height + _spriteHeight )
+			{
+				TerrainLayerTile &layerTile = _terrainLayerTiles[(itY - beginY) * sizeX + (itX - beginX)];
+				layerTile.nvColor = _nvColor;
+				layerTile.dynamic =
+					(movingUnit && positionInRangeXY(movingUnitPosition, mapPosition, 2)) ||
+					(cursorVisible && _selectorX > itX - _cursorSize && _selectorY > itY - _cursorSize && _selectorX < itX+1 && _selectorY < itY+1) ||
+					(_previewSettingArrows && tile->getPreview() != -1) ||
+					(_showObstacles && tile->isObstacle()) ||
+					tile->getOverlappingUnit(_save, TUO_ALWAYS) ||
+					tile->getTopItem() ||
+					tile->getSmoke();
+
+				int tileShade, obstacleShade, oxceFOWshade;
+				calculateTileShade(tile, colorBeforeFoW, tileShade, obstacleShade, oxceFOWshade);
+
+				const size_t firstBlit = _terrainLayerBlits.size();
+				for (auto part : { O_FLOOR, O_WESTWALL, O_NORTHWALL, O_OBJECT })
+				{
+					auto sprite = tile->getSprite(part);
+					if (sprite)
+					{
+						TerrainLayerBlit blit;
+						blit.sprite = sprite;
+						blit.x = screenPosition.x;
+						blit.y = screenPosition.y - tile->getYOffset(part);
+						blit.shade = getTerrainPartShade(tile, part, tileShade, obstacleShade, oxceFOWshade);
+						blit.color = _nvColor;
+						blit.half = part == O_NORTHWALL && bool(tile->getSprite(O_WESTWALL));
+						_terrainLayerBlits.push_back(blit);
+
+						layerTile.bounds = uniteAreas(layerTile.bounds, GraphSubset(sprite.getWidth(), sprite.getHeight()).offset(blit.x, blit.y));
+						layerTile.dynamic = layerTile.dynamic || tile->getMapData(part)->isAnimated();
+					}
+				}
+
+				if (layerTile.dynamic)
+				{
+					// only remember that the tile is not part of the layer
+					_terrainLayerBlits.resize(firstBlit);
+					TerrainLayerBlit marker = { };
+					marker.x = itX;
+					marker.y = itY;
+					_terrainLayerBlits.push_back(marker);
+
+					layerTile.bounds = uniteAreas(layerTile.bounds, dynamicArea.offset(screenPosition.x, screenPosition.y));
+					layerTile.redraw = true;
+					_terrainLayerDirty.push_back(layerTile.bounds);
+				}
+				else if (_nvColor == 1 && _terrainLayerBlits.size() != firstBlit)
+				{
+					// this color can shade pixels to 0, that can't be told apart from transparent pixels of the layer
+					usable = false;
+				}
+			}
+		}
+	}
+
+	_terrainLayerNvColor = _nvColor;
+	_nvColor = nvColorBefore;
+	_thisTileVisible = thisTileVisibleBefore;
+
+	if (!usable)
+	{
+		layer.valid = false;
+		layer.blits.clear();
+		return false;
+	}
+	if (layer.width != width || layer.height != height || layer.blits != _terrainLayerBlits)
+	{
+		// something changed, wait for it to settle down before rendering a new layer
+		layer.valid = false;
+		layer.width = width;
+		layer.height = height;
+		layer.blits.swap(_terrainLayerBlits);
+		return false;
+	}
+
+	if (!layer.valid)
+	{
+		layer.pixels.assign(width * height, 0);
+		layer.bounds = GraphSubset();
+		SurfaceRaw<Uint8> dest(layer.pixels, width, height);
+		for (const auto& blit : layer.blits)
+		{
+			if (blit.sprite)
+			{
+				Surface::blitRaw(dest, blit.sprite, blit.x, blit.y, blit.shade, blit.half, blit.color);
+				layer.bounds = uniteAreas(layer.bounds, GraphSubset(blit.sprite.getWidth(), blit.sprite.getHeight()).offset(blit.x, blit.y));
+			}
+		}
+		layer.valid = true;
+	}
+
+	// static tiles overlapping dynamic ones need to be drawn again to keep the right drawing order
+	_terrainLayerArea = layer.bounds;
+	for (auto& layerTile : _terrainLayerTiles)
+	{
+		if (!layerTile.dynamic && layerTile.bounds)
+		{
+			for (const auto& dirty : _terrainLayerDirty)
+			{
+				if (GraphSubset::intersection(layerTile.bounds, dirty))
+				{
+					layerTile.redraw = true;
+					break;
+				}
+			}
+		}
+		if (layerTile.redraw)
+		{
+			_terrainLayerArea = uniteAreas(_terrainLayerArea, layerTile.bounds);
+		}
+	}
+	_terrainLayerArea = GraphSubset::intersection(_terrainLayerArea, GraphSubset(width, height));
+
+	// remember what was below this level and which pixels are drawn by the redrawn tiles
+	_terrainLayerBackup.resize(width * height);
+	_terrainLayerMask.resize(width * height);
+	const int areaWidth = _terrainLayerArea.size_x();
+	for (int y = _terrainLayerArea.beg_y; y < _terrainLayerArea.end_y; ++y)
+	{
+		std::copy_n(surface->getRaw(_terrainLayerArea.beg_x, y), areaWidth, &_terrainLayerBackup[y * width + _terrainLayerArea.beg_x]);
+		std::fill_n(&_terrainLayerMask[y * width + _terrainLayerArea.beg_x], areaWidth, 0);
+	}
+	for (const auto& dirty : _terrainLayerDirty)
+	{
+		const GraphSubset d = GraphSubset::intersection(dirty, _terrainLayerArea);
+		for (int y = d.beg_y; y < d.end_y; ++y)
+		{
+			std::fill_n(&_terrainLayerMask[y * width + d.beg_x], d.size_x(), 1);
+		}
+	}
+	return true;
+}
+
+/**
+ * Finishes drawing of a map level from its pre-rendered static terrain.
+ * Tiles overlapping dynamic parts of the level are already drawn, outside of these parts
+ * the layer is put over what was drawn below this level.
+ * @param surface The surface to draw on.
+ * @param itZ The map level.
+ */
+void Map::compositeTerrainLayer(Surface *surface, int itZ)
+{
+	const TerrainLayer &layer = _terrainLayers[itZ];
+	const int width = surface->getWidth();
+	const int areaWidth = _terrainLayerArea.size_x();
+	for (int y = _terrainLayerArea.beg_y; y < _terrainLayerArea.end_y; ++y)
+	{
+		const int offset = y * width + _terrainLayerArea.beg_x;
+		const Uint8 *layerRow = &layer.pixels[offset];
+		const Uint8 *backupRow = &_terrainLayerBackup[offset];
+		const Uint8 *maskRow = &_terrainLayerMask[offset];
+		Uint8 *destRow = surface->getRaw(_terrainLayerArea.beg_x, y);
+		for (int x = 0; x < areaWidth; ++x)
+		{
+			if (!maskRow[x])
+			{
+				destRow[x] = layerRow[x] ? layerRow[x] : backupRow[x];
+			}
+		}
+	}
+	_nvColor = _terrainLayerNvColor;
+}
+
 /**
  * Handles mouse presses on the map.
  * @param action Pointer to an action.
@@ -2721,6 +3004,15 @@ Camera *Map::getCamera()
 	return _camera;
 }
 
+/**
+ * Gets the cache of minimap terrain, kept here so it survives between openings of the minimap.
+ * @return Pointer to minimap cache.
+ */
+MiniMapCache *Map::getMiniMapCache()
+{
+	return _miniMapCache;
+}
+
 /**
  * Timers only work on surfaces so we have to pass this on to the camera object.
  */
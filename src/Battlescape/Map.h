@@ -39,6 +39,8 @@ class Timer;
 class Text;
 class Tile;
 class UnitSprite;
+class UnitSpriteCache;
+class MiniMapCache;
 
 enum CursorType { CT_NONE, CT_NORMAL, CT_AIM, CT_PSI, CT_WAYPOINT, CT_THROW };
 enum TilePart : int;
@@ -59,6 +61,42 @@ struct UnitWalkingOffset
 class Map : public InteractiveSurface
 {
 private:
+	/**
+	 * One terrain sprite of a tile that has nothing but static terrain on it.
+	 * Tiles with dynamic content are stored as a marker without sprite.
+	 */
+	struct TerrainLayerBlit
+	{
+		SurfaceRaw<const Uint8> sprite;
+		int x, y, shade, color;
+		bool half;
+
+		bool operator==(const TerrainLayerBlit &other) const
+		{
+			return sprite.getBuffer() == other.sprite.getBuffer() && x == other.x && y == other.y && shade == other.shade && color == other.color && half == other.half;
+		}
+	};
+	/**
+	 * Pre-rendered static terrain of one map level.
+	 */
+	struct TerrainLayer
+	{
+		std::vector<Uint8> pixels;
+		std::vector<TerrainLayerBlit> blits;
+		GraphSubset bounds;
+		int width = 0, height = 0;
+		bool valid = false;
+	};
+	/**
+	 * State of one tile of the map level that is currently drawn.
+	 */
+	struct TerrainLayerTile
+	{
+		GraphSubset bounds;
+		int nvColor = 0;
+		bool dynamic = false;
+		bool redraw = false;
+	};
 	bool _thisTileVisible;
 	static const int SCROLL_INTERVAL = 15;
 	static const int FADE_INTERVAL = 23;
@@ -107,11 +145,24 @@ private:
 	bool _previewSettingArrows, _previewSettingTu, _previewSettingEnergy;
 	Text *_txtAccuracy;
 	SurfaceSet *_projectileSet;
+	std::vector<TerrainLayer> _terrainLayers;
+	std::vector<TerrainLayerBlit> _terrainLayerBlits;
+	std::vector<TerrainLayerTile> _terrainLayerTiles;
+	std::vector<GraphSubset> _terrainLayerDirty;
+	std::vector<Uint8> _terrainLayerBackup, _terrainLayerMask;
+	GraphSubset _terrainLayerArea;
+	int _terrainLayerNvColor;
+	UnitSpriteCache *_unitSpriteCache;
+	MiniMapCache *_miniMapCache;
 
 	void drawUnit(UnitSprite &unitSprite, Tile *unitTile, Tile *currTile, Position tileScreenPosition, bool topLayer, BattleUnit* movingUnit = nullptr);
 	void drawTerrain(Surface *surface);
 	int getTerrainLevel(const Position& pos, int size) const;
 	int getWallShade(TilePart part, Tile* tileFrot);
+	void calculateTileShade(Tile *tile, int colorBeforeFoW, int &tileShade, int &obstacleShade, int &oxceFOWshade);
+	int getTerrainPartShade(Tile *tile, TilePart part, int tileShade, int obstacleShade, int oxceFOWshade);
+	bool prepareTerrainLayer(Surface *surface, int itZ, int beginX, int endX, int beginY, int endY, BattleUnit *movingUnit, int colorBeforeFoW);
+	void compositeTerrainLayer(Surface *surface, int itZ);
 	int _iconHeight, _iconWidth, _messageColor;
 	int _hostileBarColor, _neutralBarColor, _borderBarColor;
 	const std::vector<Uint8> *_transparencies;
@@ -176,6 +227,8 @@ public:
 
 	/// Gets the pointer to the camera.
 	Camera *getCamera();
+	/// Gets the cache of minimap terrain.
+	MiniMapCache *getMiniMapCache();
 	/// Mouse-scrolls the camera.
 	void scrollMouse();
 	/// Keyboard-scrolls the camera.
@@ -26,6 +26,8 @@
 #include "../Interface/Text.h"
 #include "MiniMapView.h"
 #include "Camera.h"
+#include "Map.h"
+#include "BattlescapeState.h"
 #include "../Engine/Timer.h"
 #include "../Engine/Action.h"
 #include "../Engine/Options.h"
@@ -49,7 +51,7 @@ MiniMapState::MiniMapState (Camera * camera, SavedBattleGame * battleGame)
 	}
 
 	_bg = new Surface(320, 200);
-	_miniMapView = new MiniMapView(221, 148, 48, 16, _game, camera, battleGame);
+	_miniMapView = new MiniMapView(221, 148, 48, 16, _game, camera, battleGame, battleGame->getBattleState()->getMap()->getMiniMapCache());
 	_btnLvlUp = new BattlescapeButton(18, 20, 24, 62);
 	_btnLvlDwn = new BattlescapeButton(18, 20, 24, 88);
 	_btnOk = new BattlescapeButton(32, 32, 275, 145);
@@ -16,6 +16,7 @@
  * You should have received a copy of the GNU General Public License
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>
 #include "../fmath.h"
 #include "MiniMapView.h"
 #include "MiniMapState.h"
@@ -41,6 +42,119 @@ const int CELL_WIDTH = 4;
 const int CELL_HEIGHT = 4;
 const int MAX_FRAME = 2;
 
+/**
+ * Compares two cached cells.
+ * @param other Other cell.
+ * @return True if both cells look the same.
+ */
+bool MiniMapCache::Cell::operator==(const Cell& other) const
+{
+	return shade == other.shade && std::equal(parts, parts + O_MAX, other.parts);
+}
+
+/**
+ * Creates empty minimap cache.
+ */
+MiniMapCache::MiniMapCache() : _sizeX(0), _sizeY(0), _sizeZ(0)
+{
+}
+
+/**
+ * Cleans up the minimap cache.
+ */
+MiniMapCache::~MiniMapCache()
+{
+}
+
+/**
+ * Gets composited terrain of one level. Cells in given area are checked first
+ * and redrawn if tile was discovered, destroyed or its shade changed since last time,
+ * so scrolling only checks visible cells and blits whole level at once.
+ * @param save Pointer to the SavedBattleGame.
+ * @param set Minimap sprites.
+ * @param z Level of map.
+ * @param startX First visible column of map.
+ * @param startY First visible row of map.
+ * @param endX Column after last visible one.
+ * @param endY Row after last visible one.
+ * @return Surface with terrain of level, one cell per tile.
+ */
+Surface *MiniMapCache::getLevel(SavedBattleGame *save, SurfaceSet *set, int z, int startX, int startY, int endX, int endY)
+{
+	if (_sizeX != save->getMapSizeX() || _sizeY != save->getMapSizeY() || _sizeZ != save->getMapSizeZ())
+	{
+		clear();
+		_sizeX = save->getMapSizeX();
+		_sizeY = save->getMapSizeY();
+		_sizeZ = save->getMapSizeZ();
+		_levels.resize(_sizeZ);
+		Cell empty = { };
+		empty.shade = -1;
+		_cells.assign(save->getMapSizeXYZ(), empty);
+	}
+	auto& level = _levels[z];
+	if (!level)
+	{
+		level = std::make_unique<Surface>(_sizeX * CELL_WIDTH, _sizeY * CELL_HEIGHT);
+	}
+
+	startX = std::max(startX, 0);
+	startY = std::max(startY, 0);
+	endX = std::min(endX, _sizeX);
+	endY = std::min(endY, _sizeY);
+
+	for (int y = startY; y < endY; ++y)
+	{
+		for (int x = startX; x < endX; ++x)
+		{
+			Position p(x, y, z);
+			Tile *t = save->getTile(p);
+			Cell cell;
+			cell.shade = 16;
+			if (t->isDiscovered(O_FLOOR))
+			{
+				cell.shade = std::min(t->getShade(), 7); //vanilla
+			}
+			for (int i = O_FLOOR; i < O_MAX; i++)
+			{
+				MapData *data = t->getMapData((TilePart)i);
+				cell.parts[i] = data && data->getMiniMapIndex() ? data : nullptr;
+			}
+
+			Cell &cached = _cells[save->getTileIndex(p)];
+			if (cached == cell)
+			{
+				continue;
+			}
+			cached = cell;
+
+			level->drawRect(x * CELL_WIDTH, y * CELL_HEIGHT, CELL_WIDTH, CELL_HEIGHT, 0);
+			for (int i = O_FLOOR; i < O_MAX; i++)
+			{
+				if (cell.parts[i])
+				{
+					Surface *s = set->getFrame(cell.parts[i]->getMiniMapIndex() + 35);
+					if (s)
+					{
+						s->blitNShade(level.get(), x * CELL_WIDTH, y * CELL_HEIGHT, cell.shade);
+					}
+				}
+			}
+		}
+	}
+	return level.get();
+}
+
+/**
+ * Removes all cached levels.
+ */
+void MiniMapCache::clear()
+{
+	_levels.clear();
+	_cells.clear();
+	_sizeX = _sizeY = _sizeZ = 0;
+}
+
 /**
  * Initializes all the elements in the MiniMapView.
  * @param w The MiniMapView width.
@@ -50,8 +164,9 @@ const int MAX_FRAME = 2;
  * @param game Pointer to the core game.
  * @param camera The Battlescape camera.
  * @param battleGame Pointer to the SavedBattleGame.
+ * @param cache Cache of minimap terrain.
  */
-MiniMapView::MiniMapView(int w, int h, int x, int y, Game * game, Camera * camera, SavedBattleGame * battleGame) : InteractiveSurface(w, h, x, y), _game(game), _camera(camera), _battleGame(battleGame), _frame(0), _isMouseScrolling(false), _isMouseScrolled(false), _xBeforeMouseScrolling(0), _yBeforeMouseScrolling(0), _mouseScrollX(0), _mouseScrollY(0), _mouseScrollingStartTime(0), _totalMouseMoveX(0), _totalMouseMoveY(0), _mouseMovedOverThreshold(false)
+MiniMapView::MiniMapView(int w, int h, int x, int y, Game * game, Camera * camera, SavedBattleGame * battleGame, MiniMapCache * cache) : InteractiveSurface(w, h, x, y), _game(game), _camera(camera), _battleGame(battleGame), _cache(cache), _frame(0), _isMouseScrolling(false), _isMouseScrolled(false), _xBeforeMouseScrolling(0), _yBeforeMouseScrolling(0), _mouseScrollX(0), _mouseScrollY(0), _mouseScrollingStartTime(0), _totalMouseMoveX(0), _totalMouseMoveY(0), _mouseMovedOverThreshold(false)
 {
 	_set = _game->getMod()->getSurfaceSet("SCANG.DAT");
 	_emptySpaceIndex = _game->getMod()->getInterface("minimap")->getElement("emptySpace")->color;
@@ -78,8 +193,30 @@ void MiniMapView::draw()
 	{
 		isAltPressed = !isAltPressed;
 	}
+	const int endX = _startX + (getWidth() + CELL_WIDTH - 1) / CELL_WIDTH;
+	const int endY = _startY + (getHeight() + CELL_HEIGHT - 1) / CELL_HEIGHT;
+	if (isAltPressed)
+	{
+		int py = _startY;
+		for (int y = 0; y < getHeight(); y += CELL_HEIGHT)
+		{
+			int px = _startX;
+			for (int x = 0; x < getWidth(); x += CELL_WIDTH)
+			{
+				if (px < 0 || px >= _battleGame->getMapSizeX() || py < 0 || py >= _battleGame->getMapSizeY())
+				{
+					emptySpace->blitNShade(this, x, y, 0);
+				}
+				px++;
+			}
+			py++;
+		}
+	}
 	for (int lvl = 0; lvl <= _camera->getCenterPosition().z; lvl++)
 	{
+		// terrain from cache, units and items are drawn over it
+		_cache->getLevel(_battleGame, _set, lvl, _startX, _startY, endX, endY)->blitNShade(this, -_startX * CELL_WIDTH, -_startY * CELL_HEIGHT, 0);
+
 		int py = _startY;
 		for (int y = 0; y < getHeight(); y += CELL_HEIGHT)
 		{
@@ -90,32 +227,9 @@ void MiniMapView::draw()
 				Tile *t = _battleGame->getTile(p);
 				if (!t)
 				{
-					if (isAltPressed)
-					{
-						emptySpace->blitNShade(this, x, y, 0);
-					}
 					px++;
 					continue;
 				}
-				for (int i = O_FLOOR; i < O_MAX; i++)
-				{
-					MapData *data = t->getMapData((TilePart)i);
-
-					if (data && data->getMiniMapIndex())
-					{
-						Surface *s = _set->getFrame(data->getMiniMapIndex() + 35);
-						if (s)
-						{
-							int shade = 16;
-							if (t->isDiscovered(O_FLOOR))
-							{
-								shade = t->getShade();
-								if (shade > 7) shade = 7; //vanilla
-							}
-							s->blitNShade(this, x, y, shade);
-						}
-					}
-				}
 				// alive units
 				if (t->getUnit() && (t->getUnit()->getVisible() || _battleGame->getBughuntMode() || _battleGame->getDebugMode()))
 				{
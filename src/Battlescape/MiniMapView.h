@@ -17,7 +17,10 @@
  * You should have received a copy of the GNU General Public License
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <memory>
+#include <vector>
 #include "../Engine/InteractiveSurface.h"
+#include "../Mod/MapData.h"
 #include "Position.h"
 
 namespace OpenXcom
@@ -28,6 +31,37 @@ class Camera;
 class SavedBattleGame;
 class SurfaceSet;
 
+/**
+ * Terrain of every minimap level composited into one surface per level.
+ * Kept between openings of the minimap, every cell remembers what was drawn
+ * in it and is redrawn only when its terrain, discovery or shade changed.
+ */
+class MiniMapCache
+{
+	/// Everything that affects the look of one cached cell.
+	struct Cell
+	{
+		const MapData *parts[O_MAX];
+		int shade;
+
+		/// Compare cells.
+		bool operator==(const Cell& other) const;
+	};
+
+	std::vector<std::unique_ptr<Surface>> _levels;
+	std::vector<Cell> _cells;
+	int _sizeX, _sizeY, _sizeZ;
+public:
+	/// Creates empty cache.
+	MiniMapCache();
+	/// Cleans up the cache.
+	~MiniMapCache();
+	/// Gets terrain of one level, updating cells in given area first.
+	Surface *getLevel(SavedBattleGame *save, SurfaceSet *set, int z, int startX, int startY, int endX, int endY);
+	/// Removes all cached levels.
+	void clear();
+};
+
 /**
  * MiniMapView is the class used to display the map in the MiniMapState.
  */
@@ -36,6 +70,7 @@ class MiniMapView : public InteractiveSurface
 	Game * _game;
 	Camera * _camera;
 	SavedBattleGame * _battleGame;
+	MiniMapCache * _cache;
 	int _frame;
 	SurfaceSet * _set;
 	int _emptySpaceIndex;
@@ -58,7 +93,7 @@ class MiniMapView : public InteractiveSurface
 	void mouseIn(Action *action, State *state) override;
 public:
 	/// Creates the MiniMapView.
-	MiniMapView(int w, int h, int x, int y, Game * game, Camera * camera, SavedBattleGame * battleGame);
+	MiniMapView(int w, int h, int x, int y, Game * game, Camera * camera, SavedBattleGame * battleGame, MiniMapCache * cache);
 	/// Draws the minimap.
 	void draw() override;
 	/// Changes the displayed minimap level.
@@ -48,6 +48,36 @@ namespace OpenXcom
 namespace
 {
 
+/**
+ * Direction of one ray of explosion.
+ */
+struct ExplosionRay
+{
+	int te;
+	double cos_te, sin_te, sin_fi, cos_fi;
+};
+
+/**
+ * Gets directions of all rays used by explosions, calculated once.
+ */
+const std::vector<ExplosionRay>& getExplosionRays()
+{
+	static const std::vector<ExplosionRay> rays = []
+	{
+		std::vector<ExplosionRay> r;
+		for (int fi = -90; fi <= 90; fi += 5)
+		{
+			// raytrace every 3 degrees makes sure we cover all tiles in a circle.
+			for (int te = 0; te <= 360; te += 3)
+			{
+				r.push_back({ te, cos(Deg2Rad(te)), sin(Deg2Rad(te)), sin(Deg2Rad(fi)), cos(Deg2Rad(fi)) });
+			}
+		}
+		return r;
+	}();
+	return rays;
+}
+
 /**
  * Calculates a line trajectory, using bresenham algorithm in 3D.
  * @param origin Origin.
@@ -1936,14 +1966,84 @@ bool TileEngine::visible(BattleUnit *currentUnit, Tile *tile)
 		// 16 - for voxel scale calculation.
 		// Even if MaxViewDistance will be increased via ruleset, smoke will keep effect.
 		int visibilityQuality = visibleDistanceMaxVoxel - visibleDistanceVoxels - ((densityOfSmoke - densityOfSmokeNearUnit / 2) * smokeDensityFactor + (densityOfFire - densityOfFireeNearUnit / 2) * fireDensityFactor) * visibleDistanceMaxVoxel/(3 * 20 * 100 * 16);
-		ModScript::VisibilityUnit::Output arg{ visibilityQuality, visibilityQuality, ScriptTag<BattleUnitVisibility>::getNullTag() };
-		ModScript::VisibilityUnit::Worker worker{ currentUnit, tile->getUnit(), tile, visibleDistanceVoxels, visibleDistanceMaxVoxel, visibleDistanceUnitMaxTile, densityOfSmoke, densityOfFire, densityOfSmokeNearUnit, densityOfFireeNearUnit };
-		worker.execute(currentUnit->getArmor()->getScript<ModScript::VisibilityUnit>(), arg);
-		unitSeen = 0 < arg.getFirst();
+		unitSeen = 0 < calculateVisibilityScript(currentUnit, tile->getUnit(), tile, visibilityQuality, visibleDistanceVoxels, visibleDistanceMaxVoxel, visibleDistanceUnitMaxTile, densityOfSmoke, densityOfFire, densityOfSmokeNearUnit, densityOfFireeNearUnit);
 	}
 	return unitSeen;
 }
 
+/**
+ * Runs visibility script of the observer's armor.
+ * Armors without any script or global event skip the script machinery completely.
+ * Scripts that do not access any object (unit or tile) depend only on the value arguments,
+ * their results are cached until the end of the turn.
+ * @param observer The watcher.
+ * @param target Unit that is watched, can be null.
+ * @param tile Tile that is watched.
+ * @param visibilityQuality Visibility calculated by engine.
+ * @return Visibility after script, positive if target is visible.
+ */
+int TileEngine::calculateVisibilityScript(BattleUnit *observer, BattleUnit *target, Tile *tile, int visibilityQuality, int distance, int distanceMax, int distanceTargetMax, int smoke, int fire, int smokeNearObserver, int fireNearObserver)
+{
+	const auto* armor = observer->getArmor();
+	const auto& script = armor->getScript<ModScript::VisibilityUnit>();
+	if (script.isEmpty())
+	{
+		return visibilityQuality;
+	}
+
+	if (_visibilityScriptCacheTurn != _save->getTurn())
+	{
+		resetVisibilityScriptCache();
+		_visibilityScriptCacheTurn = _save->getTurn();
+	}
+
+	auto& stats = _visibilityScriptStats[armor];
+	++stats.calls;
+
+	const bool stateless = script.isStateless();
+	VisibilityScriptKey key = { &script, { visibilityQuality, distance, distanceMax, distanceTargetMax, smoke, fire, smokeNearObserver, fireNearObserver } };
+	if (stateless)
+	{
+		auto cached = _visibilityScriptCache.find(key);
+		if (cached != _visibilityScriptCache.end())
+		{
+			++stats.cached;
+			return cached->second;
+		}
+	}
+
+	ModScript::VisibilityUnit::Output arg{ visibilityQuality, visibilityQuality, ScriptTag<BattleUnitVisibility>::getNullTag() };
+	ModScript::VisibilityUnit::Worker worker{ observer, target, tile, distance, distanceMax, distanceTargetMax, smoke, fire, smokeNearObserver, fireNearObserver };
+	worker.execute(script, arg);
+
+	if (stateless)
+	{
+		// limit memory usage, in normal turn this should not be reached
+		if (_visibilityScriptCache.size() >= 0x10000)
+		{
+			_visibilityScriptCache.clear();
+		}
+		_visibilityScriptCache.insert({ key, arg.getFirst() });
+	}
+	return arg.getFirst();
+}
+
+/**
+ * Logs number of visibility script calls per armor (in debug mode) and clears cached script results.
+ */
+void TileEngine::resetVisibilityScriptCache()
+{
+	if (Options::debug)
+	{
+		for (const auto& p : _visibilityScriptStats)
+		{
+			Log(LOG_DEBUG) << "Script 'visibilityUnit' of armor '" << p.first->getType() << "' called " << p.second.calls << " times in turn " << _visibilityScriptCacheTurn << ", " << p.second.cached << " of them from cache";
+		}
+	}
+	_visibilityScriptStats.clear();
+	_visibilityScriptCache.clear();
+}
+
 /**
  * Checks to see if a tile is visible through darkness, obstacles and smoke.
  * Note: psi vision, camouflage/anti-camouflage are intentionally removed.
@@ -2115,10 +2215,7 @@ bool TileEngine::isTileInLOS(BattleAction *action, Tile *tile, bool drawing)
 		// 16 - for voxel scale calculation.
 		// Even if MaxViewDistance will be increased via ruleset, smoke will keep effect.
 		int visibilityQuality = visibleDistanceMaxVoxel - visibleDistanceVoxels - ((densityOfSmoke - densityOfSmokeNearUnit / 2) * smokeDensityFactor + (densityOfFire - densityOfFireeNearUnit / 2) * fireDensityFactor) * visibleDistanceMaxVoxel/(3 * 20 * 100 * 16);
-		ModScript::VisibilityUnit::Output arg{ visibilityQuality, visibilityQuality, ScriptTag<BattleUnitVisibility>::getNullTag() };
-		ModScript::VisibilityUnit::Worker worker{ currentUnit, /*targetUnit*/ nullptr, tile, visibleDistanceVoxels, visibleDistanceMaxVoxel, visibleDistanceUnitMaxTile, densityOfSmoke, densityOfFire, densityOfSmokeNearUnit, densityOfFireeNearUnit };
-		worker.execute(currentUnit->getArmor()->getScript<ModScript::VisibilityUnit>(), arg);
-		seen = 0 < arg.getFirst();
+		seen = 0 < calculateVisibilityScript(currentUnit, /*targetUnit*/ nullptr, tile, visibilityQuality, visibleDistanceVoxels, visibleDistanceMaxVoxel, visibleDistanceUnitMaxTile, densityOfSmoke, densityOfFire, densityOfSmokeNearUnit, densityOfFireeNearUnit);
 	}
 	return seen;
 }
@@ -2898,12 +2995,6 @@ std::vector<TileEngine::ReactionScore> TileEngine::getSpottingUnits(BattleUnit*
 				// closer than 20 tiles
 				Position::distance2dSq(unit->getPosition(), bu->getPosition()) <= getMaxViewDistanceSq())
 			{
-				BattleAction falseAction;
-				falseAction.type = BA_SNAPSHOT;
-				falseAction.actor = bu;
-				falseAction.target = unit->getPosition();
-				Position originVoxel = getOriginVoxel(falseAction, 0);
-				Position targetVoxel;
 				AIModule *ai = bu->getAIModule();
 
 				// Inquisitor's note regarding 'gotHit' variable
@@ -2929,6 +3020,19 @@ std::vector<TileEngine::ReactionScore> TileEngine::getSpottingUnits(BattleUnit*
 					gotHit = bu->wasMeleeAttackedBy(unit->getId());
 				}
 
+				// skip the expensive line of fire checks for units that can't possibly see the target
+				if (!isPossibleReactionSpotter(bu, unit, gotHit))
+				{
+					continue;
+				}
+
+				BattleAction falseAction;
+				falseAction.type = BA_SNAPSHOT;
+				falseAction.actor = bu;
+				falseAction.target = unit->getPosition();
+				Position originVoxel = getOriginVoxel(falseAction, 0);
+				Position targetVoxel;
+
 					// can actually see the target Tile, or we got hit
 				if ((bu->checkViewSector(unit->getPosition()) || gotHit) &&
 					// can actually target the unit
@@ -2985,6 +3089,37 @@ std::vector<TileEngine::ReactionScore> TileEngine::getSpottingUnits(BattleUnit*
 	return spotters;
 }
 
+/**
+ * Checks if a unit could possibly spot the target for reaction fire.
+ * Every unit keeps the tiles in its field of view in a tile-index bitset that is
+ * updated whenever it moves, turns or the terrain around it changes, so these
+ * bitsets work as a per-tile index of potential spotters. Only units that pass
+ * this cheap test need the full line of fire and visibility checks.
+ * @param spotter The unit that would react.
+ * @param target The unit that is acting.
+ * @param gotHit True if the spotter was attacked by the target, which lets it react regardless of facing.
+ * @return True if the spotter needs to be checked further.
+ */
+bool TileEngine::isPossibleReactionSpotter(BattleUnit *spotter, BattleUnit *target, bool gotHit) const
+{
+	if (gotHit || spotter->getPsiVision() > 0 || spotter->hasVisibleUnit(target))
+	{
+		return true;
+	}
+	const int size = target->getArmor()->getSize();
+	for (int x = 0; x < size; ++x)
+	{
+		for (int y = 0; y < size; ++y)
+		{
+			if (spotter->hasVisibleTile(_save->getTile(target->getPosition() + Position(x, y, 0))))
+			{
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
 /**
  * Gets the unit with the highest reaction score from the spotter vector.
  * @param spotters The vector of spotting units.
@@ -3673,9 +3808,22 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 	int hitSide = 0;
 	int diagonalWall = 0;
 	int power_;
-	std::map<Tile*, int> tilesAffected;
 	std::vector<BattleItem*> toRemove;
-	std::pair<std::map<Tile*, int>::iterator, bool> ret;
+
+	// reuse buffers from previous explosions, generation mark which tile data belong to this explosion
+	if (_explosionTiles.size() != (size_t)_save->getMapSizeXYZ())
+	{
+		_explosionTiles.assign(_save->getMapSizeXYZ(), ExplosionTileData{});
+		_explosionGeneration = 0;
+	}
+	if (++_explosionGeneration == 0)
+	{
+		std::fill(_explosionTiles.begin(), _explosionTiles.end(), ExplosionTileData{});
+		_explosionGeneration = 1;
+	}
+	const Uint32 generation = _explosionGeneration;
+	_explosionAffected.clear();
+	_explosionBlockage.clear();
 
 	if (type->FireBlastCalc)
 	{
@@ -3708,142 +3856,146 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 			hitSide = (center.x % 16 + center.y % 16 - 15) > 0 ? 1 : -1;
 	}
 
-	for (int fi = -90; fi <= 90; fi += 5)
+	for (const auto& ray : getExplosionRays())
 	{
-		// raytrace every 3 degrees makes sure we cover all tiles in a circle.
-		for (int te = 0; te <= 360; te += 3)
-		{
-			double cos_te = cos(Deg2Rad(te));
-			double sin_te = sin(Deg2Rad(te));
-			double sin_fi = sin(Deg2Rad(fi));
-			double cos_fi = cos(Deg2Rad(fi));
+		const int te = ray.te;
+		const double cos_te = ray.cos_te;
+		const double sin_te = ray.sin_te;
+		const double sin_fi = ray.sin_fi;
+		const double cos_fi = ray.cos_fi;
 
-			origin = _save->getTile(centetTile);
-			dest = origin;
-			double l = 0;
-			int tileX, tileY, tileZ;
-			power_ = power;
-			while (power_ > 0 && l <= maxRadius)
+		origin = _save->getTile(centetTile);
+		dest = origin;
+		double l = 0;
+		int tileX, tileY, tileZ;
+		power_ = power;
+		while (power_ > 0 && l <= maxRadius)
+		{
+			if (power_ > 0)
 			{
-				if (power_ > 0)
+				auto& data = _explosionTiles[dest->getIndex()]; // check if we had this tile already affected
+				const bool newTile = data.generation != generation;
+				if (newTile)
 				{
-					ret = tilesAffected.insert(std::make_pair(dest, 0)); // check if we had this tile already affected
+					data.generation = generation;
+					data.tileDamage = 0;
+					data.blockageOffset = -1;
+					_explosionAffected.push_back(dest->getIndex());
+				}
 
-					const int tileDmg = type->getTileFinalDamage(power_);
-					if (tileDmg > ret.first->second)
-					{
-						ret.first->second = tileDmg;
-					}
-					if (ret.second)
-					{
-						const int damage = type->getRandomDamage(power_);
-						BattleUnit *bu = dest->getOverlappingUnit(_save);
+				const int tileDmg = type->getTileFinalDamage(power_);
+				if (tileDmg > data.tileDamage)
+				{
+					data.tileDamage = tileDmg;
+				}
+				if (newTile)
+				{
+					const int damage = type->getRandomDamage(power_);
+					BattleUnit *bu = dest->getOverlappingUnit(_save);
 
-						toRemove.clear();
-						if (bu)
+					toRemove.clear();
+					if (bu)
+					{
+						if (dest->getPosition() == centetTile)
 						{
-							if (dest->getPosition() == centetTile)
-							{
-								// direct hit, similar to ground zero but AI will remember attacker, done for compatibility
-								hitUnit(attack, bu, Position(0, 0, 0), damage, type, rangeAtack);
-							}
-							else if (
-									(
-										Position::distance2dSq(dest->getPosition(), centetTile) < 4
-										&& dest->getPosition().z == centetTile.z
-									)
-									|| dest->getPosition().z > centetTile.z
+							// direct hit, similar to ground zero but AI will remember attacker, done for compatibility
+							hitUnit(attack, bu, Position(0, 0, 0), damage, type, rangeAtack);
+						}
+						else if (
+								(
+									Position::distance2dSq(dest->getPosition(), centetTile) < 4
+									&& dest->getPosition().z == centetTile.z
 								)
-							{
-								// ground zero effect is in effect, or unit is above explosion
-								hitUnit(attack, bu, Position(0, 0, -1), damage, type, rangeAtack);
-							}
-							else
-							{
-								// directional damage relative to explosion position.
-								// units above the explosion will be hit in the legs, units lateral to or below will be hit in the torso
-								hitUnit(attack, bu, centetTile + Position(0, 0, 5) - dest->getPosition(), damage, type, rangeAtack);
-							}
+								|| dest->getPosition().z > centetTile.z
+							)
+						{
+							// ground zero effect is in effect, or unit is above explosion
+							hitUnit(attack, bu, Position(0, 0, -1), damage, type, rangeAtack);
+						}
+						else
+						{
+							// directional damage relative to explosion position.
+							// units above the explosion will be hit in the legs, units lateral to or below will be hit in the torso
+							hitUnit(attack, bu, centetTile + Position(0, 0, 5) - dest->getPosition(), damage, type, rangeAtack);
+						}
 
-							// Affect all items and units in inventory
-							const int itemDamage = bu->getOverKillDamage();
-							if (itemDamage > 0)
+						// Affect all items and units in inventory
+						const int itemDamage = bu->getOverKillDamage();
+						if (itemDamage > 0)
+						{
+							for (auto* bi : *bu->getInventory())
 							{
-								for (auto* bi : *bu->getInventory())
+								if (!hitUnit(attack, bi->getUnit(), Position(0, 0, 0), itemDamage, type, rangeAtack) && type->getItemFinalDamage(itemDamage) > bi->getRules()->getArmor())
 								{
-									if (!hitUnit(attack, bi->getUnit(), Position(0, 0, 0), itemDamage, type, rangeAtack) && type->getItemFinalDamage(itemDamage) > bi->getRules()->getArmor())
-									{
-										toRemove.push_back(bi);
-									}
+									toRemove.push_back(bi);
 								}
 							}
 						}
-						// Affect all items and units on ground
-						for (auto* bi : *dest->getInventory())
-						{
-							if (!hitUnit(attack, bi->getUnit(), Position(0, 0, 0), damage, type) && type->getItemFinalDamage(damage) > bi->getRules()->getArmor())
-							{
-								toRemove.push_back(bi);
-							}
-						}
-						for (auto* bi : toRemove)
+					}
+					// Affect all items and units on ground
+					for (auto* bi : *dest->getInventory())
+					{
+						if (!hitUnit(attack, bi->getUnit(), Position(0, 0, 0), damage, type) && type->getItemFinalDamage(damage) > bi->getRules()->getArmor())
 						{
-							_save->removeItem(bi);
+							toRemove.push_back(bi);
 						}
-
-						hitTile(dest, damage, type);
 					}
+					for (auto* bi : toRemove)
+					{
+						_save->removeItem(bi);
+					}
+
+					hitTile(dest, damage, type);
 				}
+			}
 
-				l += 1.0;
+			l += 1.0;
 
-				tileX = int(floor(centetTile.x + 0.5 + l * sin_te * cos_fi));
-				tileY = int(floor(centetTile.y + 0.5 + l * cos_te * cos_fi));
-				tileZ = int(floor(centetTile.z + 0.5 + l * sin_fi));
+			tileX = int(floor(centetTile.x + 0.5 + l * sin_te * cos_fi));
+			tileY = int(floor(centetTile.y + 0.5 + l * cos_te * cos_fi));
+			tileZ = int(floor(centetTile.z + 0.5 + l * sin_fi));
 
-				origin = dest;
-				dest = _save->getTile(Position(tileX, tileY, tileZ));
+			origin = dest;
+			dest = _save->getTile(Position(tileX, tileY, tileZ));
 
-				if (!dest) break; // out of map!
+			if (!dest) break; // out of map!
 
-				// blockage by terrain is deducted from the explosion power
-				power_ -= type->RadiusReduction; // explosive damage decreases by 10 per tile
-				if (origin->getPosition().z != tileZ)
-					power_ -= vertdec; //3d explosion factor
+			// blockage by terrain is deducted from the explosion power
+			power_ -= type->RadiusReduction; // explosive damage decreases by 10 per tile
+			if (origin->getPosition().z != tileZ)
+				power_ -= vertdec; //3d explosion factor
 
-				if (type->FireBlastCalc)
+			if (type->FireBlastCalc)
+			{
+				int dir;
+				Pathfinding::vectorToDirection(origin->getPosition() - dest->getPosition(), dir);
+				if (dir != -1 && dir %2) power_ -= 0.5f * type->RadiusReduction; // diagonal movement costs an extra 50% for fire.
+			}
+			if (l > 0.5) {
+				if ( l > 1.5)
 				{
-					int dir;
-					Pathfinding::vectorToDirection(origin->getPosition() - dest->getPosition(), dir);
-					if (dir != -1 && dir %2) power_ -= 0.5f * type->RadiusReduction; // diagonal movement costs an extra 50% for fire.
+					power_ -= explosionBlockage(origin, dest, type->ResistType);
 				}
-				if (l > 0.5) {
-					if ( l > 1.5)
+				else //tricky bigwall deflection /Volutar
+				{
+					bool skipObject = diagonalWall == 0;
+					if (diagonalWall == Pathfinding::BIGWALLNESW) // --
 					{
-						power_ -= verticalBlockage(origin, dest, type->ResistType, false) * 2;
-						power_ -= horizontalBlockage(origin, dest, type->ResistType, false) * 2;
+						if (hitSide<0 && te >= 135 && te < 315)
+							skipObject = true;
+						if (hitSide>0 && ( te < 135 || te > 315))
+							skipObject = true;
 					}
-					else //tricky bigwall deflection /Volutar
+					if (diagonalWall == Pathfinding::BIGWALLNWSE) // |
 					{
-						bool skipObject = diagonalWall == 0;
-						if (diagonalWall == Pathfinding::BIGWALLNESW) // --
-						{
-							if (hitSide<0 && te >= 135 && te < 315)
-								skipObject = true;
-							if (hitSide>0 && ( te < 135 || te > 315))
-								skipObject = true;
-						}
-						if (diagonalWall == Pathfinding::BIGWALLNWSE) // |
-						{
-							if (hitSide>0 && te >= 45 && te < 225)
-								skipObject = true;
-							if (hitSide<0 && ( te < 45 || te > 225))
-								skipObject = true;
-						}
-						power_ -= verticalBlockage(origin, dest, type->ResistType, skipObject) * 2;
-						power_ -= horizontalBlockage(origin, dest, type->ResistType, skipObject) * 2;
-
+						if (hitSide>0 && te >= 45 && te < 225)
+							skipObject = true;
+						if (hitSide<0 && ( te < 45 || te > 225))
+							skipObject = true;
 					}
+					power_ -= verticalBlockage(origin, dest, type->ResistType, skipObject) * 2;
+					power_ -= horizontalBlockage(origin, dest, type->ResistType, skipObject) * 2;
+
 				}
 			}
 		}
@@ -3852,14 +4004,17 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 	// now detonate the tiles affected by explosion
 	if (type->ToTile > 0.0f)
 	{
-		for (auto& pair : tilesAffected)
+		// same order as tiles in map
+		std::sort(_explosionAffected.begin(), _explosionAffected.end());
+		for (int index : _explosionAffected)
 		{
-			if (detonate(pair.first, pair.second))
+			Tile *tile = _save->getTile(index);
+			if (detonate(tile, _explosionTiles[index].tileDamage))
 			{
 				_save->addDestroyedObjective();
 			}
-			applyGravity(pair.first);
-			Tile *j = _save->getTile(pair.first->getPosition() + Position(0,0,1));
+			applyGravity(tile);
+			Tile *j = _save->getTile(tile->getPosition() + Position(0,0,1));
 			if (j)
 				applyGravity(j);
 		}
@@ -3873,6 +4028,40 @@ void TileEngine::explode(BattleActionAttack attack, Position center, int power,
 	}
 }
 
+/**
+ * Gets explosion blockage between two adjacent tiles (HE blockage of walls, floors and objects).
+ * Many rays of one explosion cross the same pair of tiles, and terrain is not
+ * destroyed before all rays are done, so the value is cached for the current explosion.
+ * @param origin Tile that was already affected by current explosion.
+ * @param dest Next tile on the ray.
+ * @param type Resist type of explosion.
+ * @return Reduction of explosion power.
+ */
+int TileEngine::explosionBlockage(Tile *origin, Tile *dest, ItemDamageType type)
+{
+	const Position diff = dest->getPosition() - origin->getPosition();
+	if (std::abs(diff.x) > 1 || std::abs(diff.y) > 1 || std::abs(diff.z) > 1)
+	{
+		return verticalBlockage(origin, dest, type, false) * 2 + horizontalBlockage(origin, dest, type, false) * 2;
+	}
+
+	constexpr int neighbours = 3 * 3 * 3;
+	constexpr int unknown = std::numeric_limits<int>::min();
+	auto& data = _explosionTiles[origin->getIndex()];
+	if (data.blockageOffset == -1)
+	{
+		data.blockageOffset = (int)_explosionBlockage.size();
+		_explosionBlockage.resize(_explosionBlockage.size() + neighbours, unknown);
+	}
+
+	int& cached = _explosionBlockage[data.blockageOffset + (diff.x + 1) + (diff.y + 1) * 3 + (diff.z + 1) * 9];
+	if (cached == unknown)
+	{
+		cached = verticalBlockage(origin, dest, type, false) * 2 + horizontalBlockage(origin, dest, type, false) * 2;
+	}
+	return cached;
+}
+
 /**
  * Applies the explosive power to the tile parts. This is where the actual destruction takes place.
  * Must affect 9 objects (6 box sides and the object inside plus 2 outer walls).
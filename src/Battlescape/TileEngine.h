@@ -19,6 +19,7 @@
  */
 #include <vector>
 #include <set>
+#include <unordered_map>
 #include "Position.h"
 #include "BattlescapeGame.h"
 #include "../Mod/RuleItem.h"
@@ -32,6 +33,7 @@ class BattleUnit;
 class BattleItem;
 class Tile;
 class RuleSkill;
+class Armor;
 struct BattleAction;
 template<typename Tag, typename DataType> struct AreaSubset;
 
@@ -103,6 +105,58 @@ private:
 		int count;
 	};
 
+	/**
+	 * Helper class storing value arguments of visibility script, used as key of cached script results.
+	 */
+	struct VisibilityScriptKey
+	{
+		const ModScript::VisibilityUnit::Container *script;
+		int args[8];
+
+		bool operator==(const VisibilityScriptKey& other) const
+		{
+			return script == other.script && std::equal(std::begin(args), std::end(args), std::begin(other.args));
+		}
+	};
+
+	/**
+	 * Hash of visibility script arguments.
+	 */
+	struct VisibilityScriptKeyHash
+	{
+		size_t operator()(const VisibilityScriptKey& key) const
+		{
+			size_t hash = std::hash<const void*>{}(key.script);
+			for (int a : key.args)
+			{
+				hash = hash * 31 + std::hash<int>{}(a);
+			}
+			return hash;
+		}
+	};
+
+	/**
+	 * Helper class counting usage of visibility script of one armor.
+	 */
+	struct VisibilityScriptStats
+	{
+		Uint64 calls = 0;
+		Uint64 cached = 0;
+	};
+
+	/**
+	 * Helper class storing per tile data of explosion in progress.
+	 */
+	struct ExplosionTileData
+	{
+		/// Explosion that last touched this tile, data is valid only if equal to current one.
+		Uint32 generation = 0;
+		/// Highest damage to terrain of this tile.
+		int tileDamage = 0;
+		/// Offset of cached blockages to neighbour tiles, or -1.
+		int blockageOffset = -1;
+	};
+
 	SavedBattleGame *_save;
 	const std::vector<Uint16> *_voxelData;
 	std::vector<VisibilityBlockCache> _blockVisibility;
@@ -123,12 +177,26 @@ private:
 	std::vector<BattleUnit*> _movingUnitPrev;
 	BattleUnit* _movingUnit = nullptr;
 	std::map<std::pair<int, int>, bool> _visibilityCache;
+	std::unordered_map<VisibilityScriptKey, int, VisibilityScriptKeyHash> _visibilityScriptCache;
+	std::unordered_map<const Armor*, VisibilityScriptStats> _visibilityScriptStats;
+	int _visibilityScriptCacheTurn = -1;
+	std::vector<ExplosionTileData> _explosionTiles;
+	std::vector<int> _explosionAffected;
+	std::vector<int> _explosionBlockage;
+	Uint32 _explosionGeneration = 0;
 
 	/// Add light source.
 	void addLight(MapSubset gs, Position center, int power, LightLayers layer);
+	/// Gets explosion blockage between two adjacent tiles, cached for the duration of the current explosion.
+	int explosionBlockage(Tile *origin, Tile *dest, ItemDamageType type);
 	/// Calculate blockage amount.
 	int blockage(Tile *tile, const TilePart part, ItemDamageType type, int direction = -1, bool checkingFromOrigin = false);
 
+	/// Runs visibility script of observer, results of stateless scripts are reused for the whole turn.
+	int calculateVisibilityScript(BattleUnit *observer, BattleUnit *target, Tile *tile, int visibilityQuality, int distance, int distanceMax, int distanceTargetMax, int smoke, int fire, int smokeNearObserver, int fireNearObserver);
+	/// Logs visibility script counters and clears cached script results.
+	void resetVisibilityScriptCache();
+
 	bool setupEventVisibilitySector(const Position &observerPos, const Position &eventPos, const int &eventRadius);
 	inline bool inEventVisibilitySector(const Position &toCheck) const;
 
@@ -145,6 +213,8 @@ private:
 	ReactionScore determineReactionType(BattleUnit *unit, BattleUnit *target);
 	/// Creates a vector of units that can spot this unit.
 	std::vector<ReactionScore> getSpottingUnits(BattleUnit* unit);
+	/// Checks if a unit could possibly spot the target for reaction fire.
+	bool isPossibleReactionSpotter(BattleUnit *spotter, BattleUnit *target, bool gotHit) const;
 	/// Given a vector of spotters, and a unit, picks the spotter with the highest reaction score.
 	ReactionScore *getReactor(std::vector<ReactionScore> &spotters, BattleUnit *unit);
 	/// Tries to perform a reaction snap shot to this location.
@@ -27,10 +27,177 @@
 #include "../Mod/RuleInventory.h"
 #include "../Mod/Mod.h"
 #include "../Engine/Exception.h"
+#include <algorithm>
+#include <iterator>
 
 namespace OpenXcom
 {
 
+/**
+ * Compares two keys of unit sprite cache.
+ * @param other Other key.
+ * @return True if both describe the same look of unit part.
+ */
+bool UnitSpriteCache::Key::operator==(const Key& other) const
+{
+	return armor == other.armor && itemR == other.itemR && itemL == other.itemL && recolorUnit == other.recolorUnit &&
+		part == other.part && status == other.status && direction == other.direction &&
+		turretDirection == other.turretDirection && turretType == other.turretType &&
+		walkingPhase == other.walkingPhase && fallingPhase == other.fallingPhase &&
+		animationFrame == other.animationFrame && shade == other.shade && burn == other.burn &&
+		movementType == other.movementType && originalMovementType == other.originalMovementType &&
+		standHeight == other.standHeight && gender == other.gender &&
+		floating == other.floating && kneeled == other.kneeled && helmet == other.helmet &&
+		itemRInRightHand == other.itemRInRightHand && leftHandActive == other.leftHandActive && floorAbove == other.floorAbove;
+}
+
+/**
+ * Calculates hash of unit sprite cache key.
+ * @param key Key to hash.
+ * @return Hash value.
+ */
+size_t UnitSpriteCache::KeyHash::operator()(const Key& key) const
+{
+	size_t h = std::hash<const void*>()(key.armor);
+	auto combine = [&](size_t v)
+	{
+		h ^= v + 0x9e3779b9 + (h << 6) + (h >> 2);
+	};
+	combine(std::hash<const void*>()(key.itemR));
+	combine(std::hash<const void*>()(key.itemL));
+	combine(std::hash<const void*>()(key.recolorUnit));
+	combine(key.part);
+	combine(key.status);
+	combine(key.direction | (key.turretDirection << 4) | (key.turretType << 8));
+	combine(key.walkingPhase | (key.fallingPhase << 8));
+	combine(key.animationFrame);
+	combine(key.shade | (key.burn << 8));
+	combine(key.movementType | (key.originalMovementType << 4) | (key.gender << 8));
+	combine(key.standHeight);
+	combine(key.floating | (key.kneeled << 1) | (key.helmet << 2) | (key.itemRInRightHand << 3) | (key.leftHandActive << 4) | (key.floorAbove << 5));
+	return h;
+}
+
+/**
+ * Creates empty cache.
+ */
+UnitSpriteCache::UnitSpriteCache() : _memoryUsed(0)
+{
+
+}
+
+/**
+ * Deletes all cached sprites.
+ */
+UnitSpriteCache::~UnitSpriteCache()
+{
+
+}
+
+/**
+ * Gets cached sprite and moves it to front of LRU list.
+ * @param key Look of unit part.
+ * @return Sprite or null if not cached.
+ */
+const UnitSpriteCache::Sprite *UnitSpriteCache::find(const Key& key)
+{
+	auto it = _index.find(key);
+	if (it == _index.end())
+	{
+		return nullptr;
+	}
+	_entries.splice(_entries.begin(), _entries, it->second);
+	return &it->second->sprite;
+}
+
+/**
+ * Gets canvas for composing new sprite, it is reused by all cache misses.
+ * @param width Minimal width of canvas.
+ * @param height Minimal height of canvas.
+ * @return Cleared canvas.
+ */
+Surface *UnitSpriteCache::getCanvas(int width, int height)
+{
+	if (!_canvas || _canvas->getWidth() < width || _canvas->getHeight() < height)
+	{
+		_canvas = std::make_unique<Surface>(width, height);
+	}
+	else
+	{
+		_canvas->clear();
+	}
+	return _canvas.get();
+}
+
+/**
+ * Adds sprite composed on the canvas, only the part with drawn pixels is stored.
+ * Least recently used sprites are dropped when cache is over its memory limit.
+ * @param key Look of unit part.
+ * @return New sprite, offset is relative to position of unit part.
+ */
+const UnitSpriteCache::Sprite *UnitSpriteCache::add(const Key& key)
+{
+	const int width = _canvas->getWidth();
+	const int height = _canvas->getHeight();
+	const auto notEmpty = [](Uint8 pixel) { return pixel != 0; };
+	int minX = width, minY = height, maxX = -1, maxY = -1;
+	for (int y = 0; y < height; ++y)
+	{
+		const Uint8 *begin = _canvas->getRaw(0, y);
+		const Uint8 *end = begin + width;
+		const Uint8 *first = std::find_if(begin, end, notEmpty);
+		if (first == end)
+		{
+			continue;
+		}
+		const Uint8 *last = std::find_if(std::make_reverse_iterator(end), std::make_reverse_iterator(first), notEmpty).base();
+		minX = std::min(minX, (int)(first - begin));
+		maxX = std::max(maxX, (int)(last - begin) - 1);
+		minY = std::min(minY, y);
+		maxY = y;
+	}
+
+	Sprite sprite{ nullptr, minX - Margin, minY - Margin };
+	size_t size = 0;
+	if (maxX >= 0)
+	{
+		const int spriteWidth = maxX - minX + 1;
+		const int spriteHeight = maxY - minY + 1;
+		sprite.surface = std::make_unique<Surface>(spriteWidth, spriteHeight);
+		for (int y = 0; y < spriteHeight; ++y)
+		{
+			std::copy_n(_canvas->getRaw(minX, minY + y), spriteWidth, sprite.surface->getRaw(0, y));
+		}
+		size = (size_t)spriteWidth * spriteHeight;
+	}
+
+	while (!_entries.empty() && _memoryUsed + size > MemoryLimit)
+	{
+		auto& last = _entries.back();
+		if (last.sprite.surface)
+		{
+			_memoryUsed -= (size_t)last.sprite.surface->getWidth() * last.sprite.surface->getHeight();
+		}
+		_index.erase(last.key);
+		_entries.pop_back();
+	}
+
+	_entries.push_front(Entry{ key, std::move(sprite) });
+	_index[key] = _entries.begin();
+	_memoryUsed += size;
+	return &_entries.front().sprite;
+}
+
+/**
+ * Removes all cached sprites.
+ */
+void UnitSpriteCache::clear()
+{
+	_index.clear();
+	_entries.clear();
+	_memoryUsed = 0;
+}
+
 /**
  * Sets up a UnitSprite with the specified size and position.
  * @param width Width in pixels.
@@ -38,14 +205,14 @@ namespace OpenXcom
  * @param x X position in pixels.
  * @param y Y position in pixels.
  */
-UnitSprite::UnitSprite(Surface* dest, const Mod* mod, const SavedBattleGame* save, int frame, bool helmet, int red, int blue) :
+UnitSprite::UnitSprite(Surface* dest, const Mod* mod, const SavedBattleGame* save, int frame, bool helmet, int red, int blue, UnitSpriteCache* cache) :
 	_unit(0), _itemR(0), _itemL(0),
 	_unitSurface(0),
 	_itemSurface(const_cast<Mod*>(mod)->getSurfaceSet("HANDOB.PCK")),
 	_fireSurface(const_cast<Mod*>(mod)->getSurfaceSet("SMOKE.PCK")),
 	_breathSurface(const_cast<Mod*>(mod)->getSurfaceSet("BREATH-1.PCK", false)),
 	_facingArrowSurface(const_cast<Mod*>(mod)->getSurfaceSet("DETBLOB.DAT")),
-	_dest(dest), _save(save), _mod(mod),
+	_dest(dest), _cache(cache), _save(save), _mod(mod),
 	_part(0), _animationFrame(frame), _drawingRoutine(0),
 	_helmet(helmet),
 	_red(red), _blue(blue),
@@ -218,6 +385,75 @@ void UnitSprite::draw(const BattleUnit* unit, int part, int x, int y, int shade,
 		}
 	}
 
+	UnitSpriteCache::Key key;
+	if (_cache && getCacheKey(key))
+	{
+		auto* sprite = _cache->find(key);
+		if (!sprite)
+		{
+			const int margin = UnitSpriteCache::Margin;
+			auto* canvas = _cache->getCanvas(
+				std::max(_unitSurface->getWidth(), _itemSurface->getWidth()) + 2 * margin,
+				std::max(_unitSurface->getHeight(), _itemSurface->getHeight()) + 2 * margin
+			);
+
+			// draw all parts on canvas the same way they would be drawn on screen.
+			auto* dest = _dest;
+			_dest = canvas;
+			_x = margin;
+			_y = margin;
+			_mask = GraphSubset(canvas->getWidth(), canvas->getHeight());
+			drawParts();
+			_dest = dest;
+			_x = x;
+			_y = y;
+			_mask = mask;
+
+			sprite = _cache->add(key);
+		}
+		if (sprite->surface)
+		{
+			sprite->surface->blitNShade(_dest, _x + sprite->offX, _y + sprite->offY, 0, _mask);
+		}
+	}
+	else
+	{
+		drawParts();
+	}
+	// draw fire
+	if (unit->getFire() > 0)
+	{
+		_fireSurface->getFrame(4 + (_animationFrame / 2) % 4)->blitNShade(_dest, _x, _y, 0, _mask);
+	}
+	if (_breathSurface && _helmet && unit->getBreathExhaleFrame() >= 0 && armor->drawBubbles() && !unit->getFloorAbove())
+	{
+		auto tmpSurface = _breathSurface->getFrame(unit->getBreathExhaleFrame());
+		if (tmpSurface)
+		{
+			// lower the bubbles for shorter or kneeling units.
+			tmpSurface->blitNShade(_dest, _x, _y- 30 + (22 - unit->getHeight()), shade, _mask);
+		}
+	}
+	if (drawFacingIndicator && part == 0)
+	{
+		// draw unit facing indicator
+		auto* tmpSurface = _facingArrowSurface->getFrame(7 + ((unit->getDirection() + 1) % 8));
+		if (unit->getOriginalFaction() == FACTION_PLAYER)
+		{
+			tmpSurface->blitNShade(_dest, _x, _y, 0);
+		}
+		else
+		{
+			Surface::blitRaw(_dest, tmpSurface, _x, _y, 0, false, unit->getOriginalFaction() == FACTION_HOSTILE ? _blue : _red);
+		}
+	}
+}
+
+/**
+ * Draws all parts of current unit using its drawing routine.
+ */
+void UnitSprite::drawParts()
+{
 	// Array of drawing routines
 	void (UnitSprite::*routines[])() =
 	{
@@ -247,32 +483,81 @@ void UnitSprite::draw(const BattleUnit* unit, int part, int x, int y, int shade,
 	};
 	// Call the matching routine
 	(this->*(routines[_drawingRoutine]))();
-	// draw fire
-	if (unit->getFire() > 0)
+}
+
+/**
+ * Gets all values that affect the look of the current unit part.
+ * Units or items with sprite scripts can depend on anything, so they are never cached.
+ * @param key Key to fill.
+ * @return True if unit part can be cached.
+ */
+bool UnitSprite::getCacheKey(UnitSpriteCache::Key& key) const
+{
+	const auto* armor = _unit->getArmor();
+	if (!armor->getScript<ModScript::SelectUnitSprite>().isEmptyOrDefault() || !armor->getScript<ModScript::RecolorUnitSprite>().isEmptyOrDefault())
 	{
-		_fireSurface->getFrame(4 + (_animationFrame / 2) % 4)->blitNShade(_dest, _x, _y, 0, _mask);
+		return false;
 	}
-	if (_breathSurface && _helmet && unit->getBreathExhaleFrame() >= 0 && armor->drawBubbles() && !unit->getFloorAbove())
+	for (const auto* item : { _itemR, _itemL })
 	{
-		auto tmpSurface = _breathSurface->getFrame(unit->getBreathExhaleFrame());
-		if (tmpSurface)
+		if (item && (!item->getRules()->getScript<ModScript::SelectItemSprite>().isEmptyOrDefault() || !item->getRules()->getScript<ModScript::RecolorItemSprite>().isEmptyOrDefault()))
 		{
-			// lower the bubbles for shorter or kneeling units.
-			tmpSurface->blitNShade(_dest, _x, _y- 30 + (22 - unit->getHeight()), shade, _mask);
+			return false;
 		}
 	}
-	if (drawFacingIndicator && part == 0)
+
+	key.armor = armor;
+	key.itemR = _itemR ? _itemR->getRules() : nullptr;
+	key.itemL = _itemL ? _itemL->getRules() : nullptr;
+	// default recolor script use unit colors (e.g. soldier hair and skin), units without them can share sprites.
+	key.recolorUnit = _unit->getRecolor().empty() ? nullptr : _unit;
+	key.part = _part;
+	key.status = _unit->getStatus();
+	key.direction = _unit->getDirection();
+	key.turretDirection = _unit->getTurretDirection();
+	key.turretType = _unit->getTurretType();
+	key.walkingPhase = _unit->getWalkingPhase();
+	key.fallingPhase = _unit->getFallingPhase();
+	key.animationFrame = getCacheAnimationFrame();
+	key.shade = _shade;
+	key.burn = _burn;
+	key.movementType = _unit->getMovementType();
+	key.originalMovementType = _unit->getOriginalMovementType();
+	key.standHeight = _unit->getStandHeight();
+	key.gender = _unit->getGender();
+	key.floating = _unit->isFloating();
+	key.kneeled = _unit->isKneeled();
+	key.helmet = _helmet;
+	key.itemRInRightHand = _itemR && _itemR->getSlot() && _itemR->getSlot()->isRightHand();
+	key.leftHandActive = _itemR && _itemL && _unit->getActiveHand(_itemL, _itemR) == _itemL;
+	key.floorAbove = _unit->getFloorAbove();
+	return true;
+}
+
+/**
+ * Gets animation frame as seen by drawing routine of current unit.
+ * Most routines do not animate at all and others only loop over few frames,
+ * mapping all equal frames to one value keeps cache small.
+ * @return Animation frame that affect look of unit part.
+ */
+int UnitSprite::getCacheAnimationFrame() const
+{
+	switch (_drawingRoutine)
 	{
-		// draw unit facing indicator
-		auto* tmpSurface = _facingArrowSurface->getFrame(7 + ((unit->getDirection() + 1) % 8));
-		if (unit->getOriginalFaction() == FACTION_PLAYER)
-		{
-			tmpSurface->blitNShade(_dest, _x, _y, 0);
-		}
-		else
-		{
-			Surface::blitRaw(_dest, tmpSurface, _x, _y, 0, false, unit->getOriginalFaction() == FACTION_HOSTILE ? _blue : _red);
-		}
+	case 2:
+	case 3:
+	case 8:
+	case 9:
+	case 12:
+	case 16:
+	case 22:
+		return _animationFrame % 8;
+	case 11:
+		return _unit->getOriginalMovementType() == MT_FLY ? _animationFrame % 4 : 0;
+	case 21:
+		return _animationFrame % 4;
+	default:
+		return 0;
 	}
 }
 
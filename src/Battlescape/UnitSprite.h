@@ -19,6 +19,9 @@
  */
 #include "../Engine/Surface.h"
 #include "../Engine/Script.h"
+#include <list>
+#include <memory>
+#include <unordered_map>
 
 namespace OpenXcom
 {
@@ -28,6 +31,73 @@ class BattleItem;
 class SavedBattleGame;
 class SurfaceSet;
 class Mod;
+class Armor;
+class RuleItem;
+
+/**
+ * Cache of fully composited unit sprites.
+ * Only units without own sprite scripts are cached, for them the look depends only on values stored in the key.
+ */
+class UnitSpriteCache
+{
+public:
+	/// Border around canvas for parts drawn with offsets.
+	static constexpr int Margin = 24;
+	/// Upper limit of memory used by cached sprites.
+	static constexpr size_t MemoryLimit = 8 * 1024 * 1024;
+
+	/// All values that affect the look of one composited unit part.
+	struct Key
+	{
+		const Armor *armor;
+		const RuleItem *itemR, *itemL;
+		const BattleUnit *recolorUnit;
+		int part, status, direction, turretDirection, turretType;
+		int walkingPhase, fallingPhase, animationFrame, shade, burn;
+		int movementType, originalMovementType, standHeight, gender;
+		bool floating, kneeled, helmet, itemRInRightHand, leftHandActive, floorAbove;
+
+		/// Compare keys.
+		bool operator==(const Key& other) const;
+	};
+
+	/// Composited sprite cropped to its drawn pixels.
+	struct Sprite
+	{
+		std::unique_ptr<Surface> surface;
+		int offX, offY;
+	};
+
+private:
+	/// Hash of the key.
+	struct KeyHash
+	{
+		size_t operator()(const Key& key) const;
+	};
+	struct Entry
+	{
+		Key key;
+		Sprite sprite;
+	};
+
+	std::list<Entry> _entries;
+	std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> _index;
+	std::unique_ptr<Surface> _canvas;
+	size_t _memoryUsed;
+public:
+	/// Creates empty cache.
+	UnitSpriteCache();
+	/// Cleans up the cache.
+	~UnitSpriteCache();
+	/// Gets cached sprite and marks it as recently used.
+	const Sprite *find(const Key& key);
+	/// Gets cleared canvas for composing new sprite.
+	Surface *getCanvas(int width, int height);
+	/// Adds sprite cropped from the canvas, dropping least recently used ones over memory limit.
+	const Sprite *add(const Key& key);
+	/// Removes all cached sprites.
+	void clear();
+};
 
 /**
  * A class that renders a specific unit, given its render rules
@@ -53,6 +123,7 @@ private:
 	const BattleItem *_itemR, *_itemL;
 	const SurfaceSet *_unitSurface, *_itemSurface, *_fireSurface, *_breathSurface, *_facingArrowSurface;
 	Surface *_dest;
+	UnitSpriteCache *_cache;
 	const SavedBattleGame *_save;
 	const Mod *_mod;
 	int _part, _animationFrame, _drawingRoutine;
@@ -107,9 +178,15 @@ private:
 	void blitItem(Part& item);
 	/// Blit body sprite.
 	void blitBody(Part& body);
+	/// Calls drawing routine of current unit.
+	void drawParts();
+	/// Gets key of current unit part in sprite cache.
+	bool getCacheKey(UnitSpriteCache::Key& key) const;
+	/// Gets animation frame used by drawing routine of current unit.
+	int getCacheAnimationFrame() const;
 public:
 	/// Creates a new UnitSprite at the specified position and size.
-	UnitSprite(Surface* dest, const Mod* mod, const SavedBattleGame* save, int frame, bool helmet, int red, int blue);
+	UnitSprite(Surface* dest, const Mod* mod, const SavedBattleGame* save, int frame, bool helmet, int red, int blue, UnitSpriteCache* cache = nullptr);
 	/// Cleans up the UnitSprite.
 	~UnitSprite();
 	/// Draws the unit.
@@ -0,0 +1,235 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include "Options.h"
+#include "Logger.h"
+#include "CrossPlatform.h"
+
+namespace OpenXcom
+{
+
+namespace
+{
+
+/// Number of frames used for percentiles and overlay graph.
+const size_t FrameHistory = 240;
+/// Height of overlay graph in pixels, one pixel is one millisecond.
+const int GraphHeight = 50;
+
+const char *SectionNames[FrameProfiler::PROFILE_MAX] = { "events", "think", "blit", "map", "globe", "scale", "present" };
+const Uint8 SectionColors[FrameProfiler::PROFILE_MAX] = { 32, 48, 80, 96, 112, 128, 144 };
+
+using FrameTimes = std::array<float, FrameProfiler::PROFILE_MAX>;
+
+FrameTimes currentFrame = { };
+std::vector<FrameTimes> history(FrameHistory);
+size_t historyPos = 0;
+size_t framesRecorded = 0;
+size_t framesSinceExport = 0;
+
+/**
+ * Gets time of section without time of sections nested in it.
+ */
+float getExclusiveTime(const FrameTimes& frame, int section)
+{
+	if (section == FrameProfiler::PROFILE_BLIT)
+	{
+		return std::max(0.0f, frame[FrameProfiler::PROFILE_BLIT] - frame[FrameProfiler::PROFILE_MAP] - frame[FrameProfiler::PROFILE_GLOBE]);
+	}
+	return frame[section];
+}
+
+/**
+ * Writes 50th, 95th and 99th percentiles of every section from history to file and log.
+ */
+void exportPercentiles()
+{
+	const size_t count = std::min(framesRecorded, FrameHistory);
+	if (count == 0)
+	{
+		return;
+	}
+
+	const std::string filename = Options::getUserFolder() + "frameprofile.csv";
+	const bool newFile = !CrossPlatform::fileExists(filename);
+	std::ofstream out(filename, std::ios::app);
+	if (!out)
+	{
+		Log(LOG_WARNING) << "Failed to write frame profile to " << filename;
+		return;
+	}
+	if (newFile)
+	{
+		out << "time";
+		for (int s = 0; s < FrameProfiler::PROFILE_MAX; ++s)
+		{
+			out << "," << SectionNames[s] << "_p50," << SectionNames[s] << "_p95," << SectionNames[s] << "_p99";
+		}
+		out << "\n";
+	}
+
+	std::ostringstream summary;
+	summary << std::fixed << std::setprecision(2);
+	out << CrossPlatform::now() << std::fixed << std::setprecision(3);
+
+	std::vector<float> values(count);
+	for (int s = 0; s < FrameProfiler::PROFILE_MAX; ++s)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			values[i] = history[i][s];
+		}
+		std::sort(values.begin(), values.end());
+		const float p50 = values[count * 50 / 100];
+		const float p95 = values[std::min(count - 1, count * 95 / 100)];
+		const float p99 = values[std::min(count - 1, count * 99 / 100)];
+		out << "," << p50 << "," << p95 << "," << p99;
+		summary << " " << SectionNames[s] << "=" << p50 << "/" << p95 << "/" << p99;
+	}
+	out << "\n";
+	Log(LOG_INFO) << "Frame profile (p50/p95/p99 ms):" << summary.str();
+}
+
+} //namespace
+
+/**
+ * Starts measuring section if profiler is enabled.
+ * @param section Measured part of frame.
+ * @param result Where to store measured time in milliseconds instead of adding it to current frame,
+ * the caller is then responsible for adding it from main thread.
+ */
+FrameProfiler::Scope::Scope(Section section, float *result) : _section(section), _active(isEnabled()), _result(result)
+{
+	if (_active)
+	{
+		_start = std::chrono::steady_clock::now();
+	}
+}
+
+/**
+ * Adds measured time to current frame.
+ */
+FrameProfiler::Scope::~Scope()
+{
+	stop();
+}
+
+/**
+ * Stops measuring and adds measured time to current frame.
+ */
+void FrameProfiler::Scope::stop()
+{
+	if (_active)
+	{
+		_active = false;
+		const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+		if (_result)
+		{
+			*_result = (float)ms;
+		}
+		else
+		{
+			add(_section, ms);
+		}
+	}
+}
+
+/**
+ * Checks if profiler is enabled.
+ * @return True if any profiler mode is selected.
+ */
+bool FrameProfiler::isEnabled()
+{
+	return Options::oxceFrameProfiler > 0;
+}
+
+/**
+ * Adds time to section of current frame.
+ * Sections that run more than once per frame (like events or think) are summed.
+ * @param section Measured part of frame.
+ * @param ms Time in milliseconds.
+ */
+void FrameProfiler::add(Section section, double ms)
+{
+	currentFrame[section] += (float)ms;
+}
+
+/**
+ * Finishes current frame, stores it in history and exports statistics when history was filled again.
+ */
+void FrameProfiler::endFrame()
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	history[historyPos] = currentFrame;
+	historyPos = (historyPos + 1) % FrameHistory;
+	currentFrame = { };
+	++framesRecorded;
+
+	if (Options::oxceFrameProfiler >= 2 && ++framesSinceExport >= FrameHistory)
+	{
+		framesSinceExport = 0;
+		exportPercentiles();
+	}
+}
+
+/**
+ * Draws graph of last frames in bottom left corner, one column per frame,
+ * every section have its own color, one pixel is one millisecond.
+ * @param surface Screen surface.
+ */
+void FrameProfiler::draw(SDL_Surface *surface)
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	const int bottom = surface->h - 1;
+	const int columns = std::min((int)FrameHistory, surface->w);
+	const size_t count = std::min(framesRecorded, FrameHistory);
+	for (int x = 0; x < columns && x < (int)count; ++x)
+	{
+		const auto& frame = history[(historyPos + FrameHistory - count + x) % FrameHistory];
+		int y = bottom;
+		for (int s = 0; s < PROFILE_MAX && y > bottom - GraphHeight; ++s)
+		{
+			const int h = std::min((int)(getExclusiveTime(frame, s) + 0.5f), y - (bottom - GraphHeight));
+			if (h > 0)
+			{
+				SDL_Rect rect = { (Sint16)x, (Sint16)(y - h + 1), 1, (Uint16)h };
+				SDL_FillRect(surface, &rect, SectionColors[s]);
+				y -= h;
+			}
+		}
+	}
+	// 60 FPS frame budget
+	SDL_Rect budget = { 0, (Sint16)(bottom - 16), (Uint16)columns, 1 };
+	SDL_FillRect(surface, &budget, 1);
+}
+
+}
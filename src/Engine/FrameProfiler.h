@@ -0,0 +1,65 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <chrono>
+#include <SDL.h>
+
+namespace OpenXcom
+{
+
+/**
+ * Measures time spent in parts of every frame.
+ * Controlled by option `oxceFrameProfiler`: 1 shows frame graph overlay,
+ * 2 also writes rolling percentiles to `frameprofile.csv` in user folder.
+ */
+class FrameProfiler
+{
+public:
+	/// Measured parts of frame, nested sections are subtracted from their parent in overlay.
+	enum Section { PROFILE_EVENTS, PROFILE_THINK, PROFILE_BLIT, PROFILE_MAP, PROFILE_GLOBE, PROFILE_SCALE, PROFILE_PRESENT, PROFILE_MAX };
+
+	/**
+	 * Measures time of one section while in scope.
+	 */
+	class Scope
+	{
+		Section _section;
+		bool _active;
+		float *_result;
+		std::chrono::steady_clock::time_point _start;
+	public:
+		/// Starts measuring section if profiler is enabled, optional result replaces adding time to current frame (for use outside of main thread).
+		Scope(Section section, float *result = nullptr);
+		/// Adds measured time to current frame.
+		~Scope();
+		/// Stops measuring before end of scope.
+		void stop();
+	};
+
+	/// Checks if profiler is enabled.
+	static bool isEnabled();
+	/// Adds time to section of current frame.
+	static void add(Section section, double ms);
+	/// Finishes current frame, stores it in history and exports statistics when needed.
+	static void endFrame();
+	/// Draws graph of last frames.
+	static void draw(SDL_Surface *surface);
+};
+
+}
@@ -38,6 +38,7 @@
 #include "Options.h"
 #include "CrossPlatform.h"
 #include "FileMap.h"
+#include "FrameProfiler.h"
 #include "Unicode.h"
 #include "../Ufopaedia/UfopaediaStartState.h"
 #include "../Menu/NotesState.h"
@@ -57,7 +58,7 @@ const double Game::VOLUME_GRADIENT = 10.0;
  * creates the display screen and sets up the cursor.
  * @param title Title of the game window.
  */
-Game::Game(const std::string &title) : _screen(0), _cursor(0), _lang(0), _save(0), _mod(0), _quit(false), _init(false), _update(false),  _mouseActive(true), _timeUntilNextFrame(0),
+Game::Game(const std::string &title) : _screen(0), _cursor(0), _lang(0), _save(0), _mod(0), _quit(false), _init(false), _update(false),  _mouseActive(true), _headless(false), _timeUntilNextFrame(0),
 	_ctrl(false), _alt(false), _shift(false), _rmb(false), _mmb(false), _scrollStep(1)
 {
 	Options::reload = false;
@@ -181,6 +182,7 @@ void Game::run()
 		}
 
 		// Process events
+		FrameProfiler::Scope profileEvents(FrameProfiler::PROFILE_EVENTS);
 		while (SDL_PollEvent(&_event))
 		{
 			if (CrossPlatform::isQuitShortcut(_event))
@@ -328,12 +330,16 @@ void Game::run()
 				break;
 			}
 		}
+		profileEvents.stop();
 
 		// Process rendering
-		if (runningState != PAUSED)
+		if (runningState != PAUSED || _headless)
 		{
 			// Process logic
-			_states.back()->think();
+			{
+				FrameProfiler::Scope profileThink(FrameProfiler::PROFILE_THINK);
+				_states.back()->think();
+			}
 			_fpsCounter->think();
 			if (Options::FPS > 0 && !(Options::useOpenGL && Options::vSyncForOpenGL))
 			{
@@ -347,7 +353,7 @@ void Game::run()
 				_timeUntilNextFrame = 0;
 			}
 
-			if (_init && _timeUntilNextFrame <= 0)
+			if (_init && !_headless && _timeUntilNextFrame <= 0)
 			{
 				// make a note of when this frame update occurred.
 				_timeOfLastFrame = SDL_GetTicks();
@@ -360,13 +366,18 @@ void Game::run()
 				}
 				while (i != _states.begin() && !(*i)->isScreen());
 
-				for (; i != _states.end(); ++i)
 				{
-					(*i)->blit();
+					FrameProfiler::Scope profileBlit(FrameProfiler::PROFILE_BLIT);
+					for (; i != _states.end(); ++i)
+					{
+						(*i)->blit();
+					}
 				}
 				_fpsCounter->blit(_screen->getSurface());
+				FrameProfiler::draw(_screen->getSurface());
 				_cursor->blit(_screen->getSurface());
 				_screen->flip();
+				FrameProfiler::endFrame();
 			}
 		}
 
@@ -520,6 +531,17 @@ void Game::setMouseActive(bool active)
 	_cursor->setVisible(active);
 }
 
+/**
+ * Changes whether frames are rendered at all. Headless game
+ * still runs its states, but skips blitting and flipping the
+ * screen, like when fast-forwarding a save from command line.
+ * @param headless Skip rendering?
+ */
+void Game::setHeadless(bool headless)
+{
+	_headless = headless;
+}
+
 /**
  * Returns whether current state is *state
  * @param state The state to test against the stack state
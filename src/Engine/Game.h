@@ -53,7 +53,7 @@ private:
 	Mod *_mod;
 	bool _quit, _init, _update;
 	FpsCounter *_fpsCounter;
-	bool _mouseActive;
+	bool _mouseActive, _headless;
 	unsigned int _timeOfLastFrame;
 	int _timeUntilNextFrame;
 	bool _ctrl, _alt, _shift, _rmb, _mmb;
@@ -97,6 +97,8 @@ public:
 	void loadMods();
 	/// Sets whether the mouse cursor is activated.
 	void setMouseActive(bool active);
+	/// Sets whether the game runs without rendering any frames.
+	void setHeadless(bool headless);
 	/// Returns whether current state is the param state
 	bool isState(State *state) const;
 	/// Returns whether a UfopaediaStartState is in the background.
@@ -27,6 +27,7 @@
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <cstdlib>
 #include "../Engine/Yaml.h"
 #include "Exception.h"
 #include "Logger.h"
@@ -57,6 +58,9 @@ int _passwordCheck = -1;
 bool _loadLastSave = false;
 std::string _loadThisSave = "";
 bool _loadLastSaveExpended = false;
+int _simulateDays = 0;
+uint64_t _simulateSeed = 0;
+std::string _simulateBattles = "hold";
 
 /**
  * Sets up the options by creating their OptionInfo metadata.
@@ -364,6 +368,8 @@ void createOptionsOXCE()
 	_info.push_back(OptionInfo(OPTION_OXCE, "oxceThumbButtons", &oxceThumbButtons, true));
 	_info.push_back(OptionInfo(OPTION_OXCE, "oxceThrottleMouseMoveEvent", &oxceThrottleMouseMoveEvent, 0));
 	_info.push_back(OptionInfo(OPTION_OXCE, "oxceDisableThinkingProgressBar", &oxceDisableThinkingProgressBar, false));
+	_info.push_back(OptionInfo(OPTION_OXCE, "oxceFrameProfiler", &oxceFrameProfiler, 0));
+	_info.push_back(OptionInfo(OPTION_OXCE, "oxcePresentThread", &oxcePresentThread, false)); // only used with windib video driver, other SDL 1.2 drivers can't flip outside of main thread
 
 	_info.push_back(OptionInfo(OPTION_OXCE, "oxceEmbeddedOnly", &oxceEmbeddedOnly, true));
 	_info.push_back(OptionInfo(OPTION_OXCE, "oxceListVFSContents", &oxceListVFSContents, false));
@@ -747,6 +753,18 @@ static void loadArgs()
 					_loadLastSave = true;
 					_loadThisSave = argv[i];
 				}
+				else if (argname == "simulate")
+				{
+					_simulateDays = std::max(0, std::atoi(argv[i].c_str()));
+				}
+				else if (argname == "seed")
+				{
+					_simulateSeed = std::strtoull(argv[i].c_str(), nullptr, 10);
+				}
+				else if (argname == "simulatebattles")
+				{
+					_simulateBattles = argv[i];
+				}
 				else
 				{
 					//save this command line option for now, we will apply it later
@@ -785,6 +803,12 @@ static bool showHelp()
 	help << "        load last save" << std::endl << std::endl;
 	help << "-load FILENAME" << std::endl;
 	help << "        load the specified FILENAME (from the corresponding master mod subfolder)" << std::endl << std::endl;
+	help << "-simulate DAYS" << std::endl;
+	help << "        fast-forward the loaded geoscape save by DAYS days without player input, report timings and quit" << std::endl << std::endl;
+	help << "-seed NUMBER" << std::endl;
+	help << "        use NUMBER as random seed for -simulate" << std::endl << std::endl;
+	help << "-simulateBattles POLICY" << std::endl;
+	help << "        outcome of base defenses during -simulate, no battle is fought: hold (default) or lose" << std::endl << std::endl;
 	help << "-version" << std::endl;
 	help << "        show version number" << std::endl << std::endl;
 	help << "-help" << std::endl;
@@ -1197,6 +1221,21 @@ void expendLoadLastSave()
 	_loadLastSaveExpended = true;
 }
 
+int getSimulateDays()
+{
+	return _simulateDays;
+}
+
+uint64_t getSimulateSeed()
+{
+	return _simulateSeed;
+}
+
+const std::string& getSimulateBattles()
+{
+	return _simulateBattles;
+}
+
 /**
  * Sets up the game's Data folder where the data files
  * are loaded from and the User folder and Config
@@ -17,6 +17,7 @@
  * You should have received a copy of the GNU General Public License
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "OptionInfo.h"
@@ -135,6 +136,12 @@ namespace Options
 	const std::string& getLoadThisSave();
 	/// And do it only at startup
 	void expendLoadLastSave();
+	/// Number of game days to fast-forward the loaded save without player input, 0 if disabled.
+	int getSimulateDays();
+	/// Random seed for the fast-forward, 0 keeps the current seed.
+	uint64_t getSimulateSeed();
+	/// Outcome of base defenses during the fast-forward.
+	const std::string& getSimulateBattles();
 }
 
 }
@@ -133,6 +133,8 @@ OPT bool oxceFirstPersonViewFisheyeProjection;
 OPT bool oxceThumbButtons;
 OPT int oxceThrottleMouseMoveEvent;
 OPT bool oxceDisableThinkingProgressBar;
+OPT int oxceFrameProfiler;
+OPT bool oxcePresentThread;
 
 OPT bool oxceEmbeddedOnly;
 OPT bool oxceListVFSContents;
@@ -33,6 +33,7 @@
 #include "FileMap.h"
 #include "Zoom.h"
 #include "Timer.h"
+#include "FrameProfiler.h"
 #include <SDL.h>
 #include <algorithm>
 
@@ -112,7 +113,8 @@ void Screen::makeVideoFlags()
  * Initializes a new display screen for the game to render contents to.
  * The screen is set up based on the current options.
  */
-Screen::Screen() : _baseWidth(ORIGINAL_WIDTH), _baseHeight(ORIGINAL_HEIGHT), _scaleX(1.0), _scaleY(1.0), _flags(0), _numColors(0), _firstColor(0), _pushPalette(false), _flickerFix(false)
+Screen::Screen() : _baseWidth(ORIGINAL_WIDTH), _baseHeight(ORIGINAL_HEIGHT), _scaleX(1.0), _scaleY(1.0), _flags(0), _numColors(0), _firstColor(0), _pushPalette(false), _flickerFix(false),
+	_presentThread(nullptr), _frameReady(nullptr), _frameIdle(nullptr), _presentQuit(false), _clearScreen(false), _frameClear(false), _frameNumColors(0), _frameFirstColor(0), _presentTimes()
 {
 	_flickerFix = Options::oxceEnablePaletteFlickerFix;
 
@@ -126,7 +128,7 @@ Screen::Screen() : _baseWidth(ORIGINAL_WIDTH), _baseHeight(ORIGINAL_HEIGHT), _sc
  */
 Screen::~Screen()
 {
-
+	stopPresentThread();
 }
 
 /**
@@ -190,42 +192,237 @@ void Screen::handle(Action *action)
  */
 void Screen::flip()
 {
-	// perform any requested palette update
-	if (_flickerFix && _pushPalette && _numColors && _screen->format->BitsPerPixel == 8)
+	if (_presentThread)
+	{
+		submitFrame();
+		return;
+	}
+
+	const bool pushPalette = _pushPalette && _numColors && _screen->format->BitsPerPixel == 8;
+	present(_surface.get(), deferredPalette, _firstColor, pushPalette ? _numColors : 0, nullptr);
+	if (pushPalette)
 	{
-		if (_screen->format->BitsPerPixel == 8 && SDL_SetColors(_screen, &(deferredPalette[_firstColor]), _firstColor, _numColors) == 0)
-		{
-			Log(LOG_DEBUG) << "Display palette doesn't match requested palette";
-		}
 		_numColors = 0;
 		_pushPalette = false;
 	}
+}
 
-	if (getWidth() != _baseWidth || getHeight() != _baseHeight || useOpenGL())
+/**
+ * Scales the frame onto the game window, applies any
+ * requested palette update and shows the result.
+ * Called either from main thread or from the present thread.
+ * @param frame 8bpp or 32bpp frame with the same size as the internal buffer.
+ * @param palette Palette of the display.
+ * @param firstColor Offset of the first color to update.
+ * @param numColors Amount of colors to update, zero if the palette didn't change.
+ * @param times Where to store scaling and present time for the profiler, null to add them to the current frame directly.
+ */
+void Screen::present(SDL_Surface *frame, const SDL_Color *palette, int firstColor, int numColors, float *times)
+{
+	// perform any requested palette update
+	if (_flickerFix && numColors)
 	{
-		Zoom::flipWithZoom(_surface.get(), _screen, _topBlackBand, _bottomBlackBand, _leftBlackBand, _rightBlackBand, &glOutput);
+		if (SDL_SetColors(_screen, const_cast<SDL_Color *>(&palette[firstColor]), firstColor, numColors) == 0)
+		{
+			Log(LOG_DEBUG) << "Display palette doesn't match requested palette";
+		}
 	}
-	else
+
 	{
-		SDL_BlitSurface(_surface.get(), 0, _screen, 0);
+		FrameProfiler::Scope profile(FrameProfiler::PROFILE_SCALE, times ? &times[0] : nullptr);
+		if (getWidth() != _baseWidth || getHeight() != _baseHeight || useOpenGL())
+		{
+			Zoom::flipWithZoom(frame, _screen, _topBlackBand, _bottomBlackBand, _leftBlackBand, _rightBlackBand, &glOutput);
+		}
+		else
+		{
+			SDL_BlitSurface(frame, 0, _screen, 0);
+		}
 	}
 
 	// perform any requested palette update
-	if (!_flickerFix && _pushPalette && _numColors && _screen->format->BitsPerPixel == 8)
+	if (!_flickerFix && numColors)
 	{
-		if (_screen->format->BitsPerPixel == 8 && SDL_SetColors(_screen, &(deferredPalette[_firstColor]), _firstColor, _numColors) == 0)
+		if (SDL_SetColors(_screen, const_cast<SDL_Color *>(&palette[firstColor]), firstColor, numColors) == 0)
 		{
 			Log(LOG_DEBUG) << "Display palette doesn't match requested palette";
 		}
+	}
+
+	FrameProfiler::Scope profile(FrameProfiler::PROFILE_PRESENT, times ? &times[1] : nullptr);
+	if (SDL_Flip(_screen) == -1)
+	{
+		throw Exception(SDL_GetError());
+	}
+}
+
+/**
+ * Copies the internal buffer and the pending palette changes into
+ * the frame owned by the present thread and wakes it up.
+ * Only waits if the previous frame is still being shown, so the
+ * game can start on the next frame while this one is scaled and flipped.
+ */
+void Screen::submitFrame()
+{
+	SDL_SemWait(_frameIdle);
+	if (!_presentError.empty())
+	{
+		SDL_SemPost(_frameIdle);
+		throw Exception(_presentError);
+	}
+	FrameProfiler::add(FrameProfiler::PROFILE_SCALE, _presentTimes[0]);
+	FrameProfiler::add(FrameProfiler::PROFILE_PRESENT, _presentTimes[1]);
+	_presentTimes[0] = _presentTimes[1] = 0.0f;
+
+	SDL_Surface *src = _surface.get();
+	if (!_frame || _frame->w != src->w || _frame->h != src->h || _frame->format->BitsPerPixel != src->format->BitsPerPixel)
+	{
+		if (src->format->BitsPerPixel == 32)
+		{
+			std::tie(_frameBuffer, _frame) = Surface::NewPair32Bit(src->w, src->h);
+		}
+		else
+		{
+			std::tie(_frameBuffer, _frame) = Surface::NewPair8Bit(src->w, src->h);
+		}
+		SDL_SetColorKey(_frame.get(), 0, 0);
+	}
+	for (int y = 0; y < src->h; ++y)
+	{
+		memcpy((Uint8*)_frame->pixels + y * _frame->pitch, (Uint8*)src->pixels + y * src->pitch, src->w * src->format->BytesPerPixel);
+	}
+	if (src->format->BitsPerPixel == 8)
+	{
+		SDL_SetColors(_frame.get(), src->format->palette->colors, 0, 256);
+	}
+
+	_frameClear = _clearScreen;
+	_clearScreen = false;
+
+	_frameNumColors = 0;
+	if (_pushPalette && _numColors && _screen->format->BitsPerPixel == 8)
+	{
+		memcpy(_framePalette, deferredPalette, sizeof(_framePalette));
+		_frameFirstColor = _firstColor;
+		_frameNumColors = _numColors;
 		_numColors = 0;
 		_pushPalette = false;
 	}
 
+	SDL_SemPost(_frameReady);
+}
+
+/**
+ * Main loop of the present thread, shows every submitted frame
+ * until the thread is asked to quit.
+ * @param data Pointer to the screen.
+ * @return Thread exit code.
+ */
+int Screen::presentLoop(void *data)
+{
+	auto *screen = static_cast<Screen*>(data);
+	while (true)
+	{
+		SDL_SemWait(screen->_frameReady);
+		if (screen->_presentQuit)
+		{
+			return 0;
+		}
+		try
+		{
+			if (screen->_frameClear)
+			{
+				Surface::CleanSdlSurface(screen->_screen);
+			}
+			screen->present(screen->_frame.get(), screen->_framePalette, screen->_frameFirstColor, screen->_frameNumColors, screen->_presentTimes);
+		}
+		catch (Exception &e)
+		{
+			// rethrown on main thread with next frame
+			screen->_presentError = e.what();
+		}
+		SDL_SemPost(screen->_frameIdle);
+	}
+}
+
+/**
+ * Starts the thread that scales and flips frames when requested by options.
+ * SDL 1.2 video and event functions are not thread safe, e.g. X11 driver would share
+ * one Xlib connection between flipping and event pumping, so only the Windows GDI
+ * driver that is known to handle it gets the thread. OpenGL contexts are bound
+ * to the thread that created them, so they keep the old behavior too.
+ */
+void Screen::startPresentThread()
+{
+	if (_presentThread || !Options::oxcePresentThread || useOpenGL())
+	{
+		return;
+	}
+	char driver[32] = {};
+	if (!SDL_VideoDriverName(driver, sizeof(driver)) || std::string(driver) != "windib")
+	{
+		Log(LOG_INFO) << "Video driver '" << driver << "' doesn't support present thread, presenting frames on main thread.";
+		return;
+	}
+	_frameReady = SDL_CreateSemaphore(0);
+	_frameIdle = SDL_CreateSemaphore(1);
+	_presentQuit = false;
+	_presentError.clear();
+	if (_frameReady && _frameIdle)
+	{
+		_presentThread = SDL_CreateThread(presentLoop, this);
+	}
+	if (!_presentThread)
+	{
+		Log(LOG_WARNING) << "Failed to start present thread: " << SDL_GetError();
+		stopPresentThread();
+		return;
+	}
+	Log(LOG_INFO) << "Presenting frames on separate thread.";
+}
 
+/**
+ * Stops the present thread, waits until it finishes the frame it is showing.
+ */
+void Screen::stopPresentThread()
+{
+	if (_presentThread)
+	{
+		SDL_SemWait(_frameIdle);
+		_presentQuit = true;
+		SDL_SemPost(_frameReady);
+		SDL_WaitThread(_presentThread, nullptr);
+		_presentThread = nullptr;
+		if (_clearScreen)
+		{
+			Surface::CleanSdlSurface(_screen);
+			_clearScreen = false;
+		}
+	}
+	if (_frameReady)
+	{
+		SDL_DestroySemaphore(_frameReady);
+		_frameReady = nullptr;
+	}
+	if (_frameIdle)
+	{
+		SDL_DestroySemaphore(_frameIdle);
+		_frameIdle = nullptr;
+	}
+	_frame.reset();
+	_frameBuffer.reset();
+}
 
-	if (SDL_Flip(_screen) == -1)
+/**
+ * Waits until the present thread is done with the display surface,
+ * needed before main thread can touch it.
+ */
+void Screen::waitForPresent() const
+{
+	if (_presentThread)
 	{
-		throw Exception(SDL_GetError());
+		SDL_SemWait(_frameIdle);
+		SDL_SemPost(_frameIdle);
 	}
 }
 
@@ -235,7 +432,15 @@ void Screen::flip()
 void Screen::clear()
 {
 	Surface::CleanSdlSurface(_surface.get());
-	Surface::CleanSdlSurface(_screen);
+	if (!_presentThread)
+	{
+		Surface::CleanSdlSurface(_screen);
+	}
+	else
+	{
+		// display surface belongs to present thread, it clears it before next frame
+		_clearScreen = true;
+	}
 }
 
 /**
@@ -265,9 +470,13 @@ void Screen::setPalette(const SDL_Color* colors, int firstcolor, int ncolors, bo
 	SDL_SetColors(_surface.get(), const_cast<SDL_Color *>(colors), firstcolor, ncolors);
 
 	// defer actual update of screen until SDL_Flip()
-	if (immediately && _screen->format->BitsPerPixel == 8 && SDL_SetColors(_screen, const_cast<SDL_Color *>(colors), firstcolor, ncolors) == 0)
+	if (immediately && _screen->format->BitsPerPixel == 8)
 	{
-		Log(LOG_DEBUG) << "Display palette doesn't match requested palette";
+		waitForPresent();
+		if (SDL_SetColors(_screen, const_cast<SDL_Color *>(colors), firstcolor, ncolors) == 0)
+		{
+			Log(LOG_DEBUG) << "Display palette doesn't match requested palette";
+		}
 	}
 
 	// Sanity check
@@ -326,6 +535,8 @@ void Screen::resetDisplay(bool resetVideo, bool noShaders)
 	Uint32 oldFlags = _flags;
 #endif
 
+	stopPresentThread();
+
 	int width = Options::displayWidth;
 	int height = Options::displayHeight;
 	makeVideoFlags();
@@ -497,6 +708,8 @@ void Screen::resetDisplay(bool resetVideo, bool noShaders)
 	{
 		setPalette(getPalette());
 	}
+
+	startPresentThread();
 }
 
 /**
@@ -541,6 +754,7 @@ int Screen::getCursorLeftBlackBand() const
  */
 void Screen::screenshot(const std::string &filename) const
 {
+	waitForPresent();
 	SDL_Surface *screenshot = SDL_AllocSurface(0, getWidth() - getWidth()%4, getHeight(), 24, 0xff, 0xff00, 0xff0000, 0);
 
 	if (useOpenGL())
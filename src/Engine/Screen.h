@@ -52,8 +52,29 @@ private:
 	OpenGL glOutput;
 	Surface::UniqueBufferPtr _buffer;
 	Surface::UniqueSurfacePtr _surface;
+	SDL_Thread *_presentThread;
+	SDL_sem *_frameReady, *_frameIdle;
+	bool _presentQuit, _clearScreen, _frameClear;
+	std::string _presentError;
+	Surface::UniqueBufferPtr _frameBuffer;
+	Surface::UniqueSurfacePtr _frame;
+	SDL_Color _framePalette[256];
+	int _frameNumColors, _frameFirstColor;
+	float _presentTimes[2];
 	/// Sets the _flags and _bpp variables based on game options; needed in more than one place now
 	void makeVideoFlags();
+	/// Scales the frame onto the game window, applies palette changes and shows it.
+	void present(SDL_Surface *frame, const SDL_Color *palette, int firstColor, int numColors, float *times);
+	/// Copies the internal buffer and hands it over to the present thread.
+	void submitFrame();
+	/// Main loop of the present thread.
+	static int presentLoop(void *data);
+	/// Starts the present thread if enabled and supported by the current video driver and mode.
+	void startPresentThread();
+	/// Stops the present thread after it shows the last frame.
+	void stopPresentThread();
+	/// Waits until the present thread is done with the display surface.
+	void waitForPresent() const;
 public:
 	static const int ORIGINAL_WIDTH;
 	static const int ORIGINAL_HEIGHT;
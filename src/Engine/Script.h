@@ -391,7 +391,12 @@ struct TypeInfo
 class ScriptContainerBase
 {
 	friend struct ParserWriter;
+	friend class ScriptParserBase;
 	std::vector<Uint8> _proc;
+	bool _stateless = true;
+	bool _sideEffects = false;
+	bool _default = false;
+	Uint16 _paramsUsed = 0;
 
 public:
 	/// Constructor.
@@ -420,6 +425,30 @@ public:
 	{
 		return *this ? _proc.data() : nullptr;
 	}
+
+	/// Test if script result depends only on its value arguments (it do not use any object or have side effects).
+	bool isStateless() const
+	{
+		return _stateless;
+	}
+
+	/// Test if script is parser default one, used when mod do not define own script.
+	bool isDefault() const
+	{
+		return _default;
+	}
+
+	/// Test if script have side effects (like logging) and every call need to be executed.
+	bool haveSideEffects() const
+	{
+		return _sideEffects;
+	}
+
+	/// Test if script result depends only on first output argument and values that do not change during one call (like objects pointers).
+	bool dependsOnlyOnFirstParam() const
+	{
+		return !_sideEffects && (_paramsUsed & ~1u) == 0;
+	}
 };
 
 /**
@@ -467,6 +496,56 @@ public:
 	{
 		return _events;
 	}
+
+	/// Test if script and all global events fulfill some predicate.
+	template<typename F>
+	bool allScripts(F&& f) const
+	{
+		if (!f(_current))
+		{
+			return false;
+		}
+		auto ptr = _events;
+		if (ptr)
+		{
+			// events before script and events after script are separated by empty container.
+			for (int i = 0; i < 2; ++i, ++ptr)
+			{
+				for (; *ptr; ++ptr)
+				{
+					if (!f(*ptr))
+					{
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	/// Test if script and all global events depend only on its value arguments.
+	bool isStateless() const
+	{
+		return allScripts([](const ScriptContainerBase& c) { return c.isStateless(); });
+	}
+
+	/// Test if script and all global events depend only on first output argument and values that do not change during one call.
+	bool dependsOnlyOnFirstParam() const
+	{
+		return allScripts([](const ScriptContainerBase& c) { return c.dependsOnlyOnFirstParam(); });
+	}
+
+	/// Test if there is neither script nor any global event.
+	bool isEmpty() const
+	{
+		return allScripts([](const ScriptContainerBase& c) { return !c; });
+	}
+
+	/// Test if there is no global event and script is missing or parser default one.
+	bool isEmptyOrDefault() const
+	{
+		return allScripts([](const ScriptContainerBase& c) { return !c || c.isDefault(); });
+	}
 };
 
 /**
@@ -822,13 +901,18 @@ class ScriptWorkerBlit : public ScriptWorkerBase
 	/// Current script set in worker.
 	const Uint8* _proc;
 	const ScriptContainerBase* _events;
+	/// Script result depends only on source pixel, it can be cached per color.
+	bool _colorOnly;
+
+	/// Execute script and all events for one pixel.
+	int executePixel(int src, int dest);
 
 public:
 	/// Type of output value from script.
 	using Output = ScriptOutputArgs<int&, int>;
 
 	/// Default constructor.
-	ScriptWorkerBlit() : ScriptWorkerBase(), _proc(nullptr), _events(nullptr)
+	ScriptWorkerBlit() : ScriptWorkerBase(), _proc(nullptr), _events(nullptr), _colorOnly(false)
 	{
 
 	}
@@ -843,6 +927,7 @@ public:
 		{
 			_proc = c.data();
 			_events = nullptr;
+			_colorOnly = c.dependsOnlyOnFirstParam();
 			updateBase<Output>(args...);
 		}
 	}
@@ -857,6 +942,7 @@ public:
 		{
 			_proc = c.data();
 			_events = c.dataEvents();
+			_colorOnly = c.dependsOnlyOnFirstParam();
 			updateBase<Output>(args...);
 		}
 	}
@@ -871,6 +957,7 @@ public:
 	{
 		_proc = nullptr;
 		_events = nullptr;
+		_colorOnly = false;
 	}
 };
 
@@ -156,6 +156,13 @@ struct ParserWriter
 	/// index of used script registers.
 	RegEnum regIndexUsed;
 
+	/// script do not access any object pointer and do not have side effects.
+	bool stateless = true;
+	/// script have side effects like logging.
+	bool sideEffects = false;
+	/// bit mask of output arguments used by script.
+	Uint16 paramsUsed = 0;
+
 	/// Stack of registers limited to code blocks.
 	std::vector<ScriptRefData> regStack;
 	/// Store position of blocks of code like "if" or "while".
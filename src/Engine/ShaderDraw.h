@@ -30,12 +30,12 @@ static inline First&& GetFirst(First&& f, Rest&&... r)
 }
 
 /**
- * Universal blit function implementation.
- * @param f called function.
+ * Universal blit function implementation working on whole rows.
+ * @param f called function, get length of row and all control objects set on first pixel of row.
  * @param src source surfaces control objects.
  */
 template<typename Func, typename... SrcType>
-static inline void ShaderDrawImpl(Func&& f, helper::controler<SrcType>... src)
+static inline void ShaderDrawRowsImpl(Func&& f, helper::controler<SrcType>... src)
 {
 	//get basic draw range in 2d space
 	GraphSubset end_temp = GetFirst(src...).get_range();
@@ -76,26 +76,41 @@ static inline void ShaderDrawImpl(Func&& f, helper::controler<SrcType>... src)
 		//set final iteration range
 		(src.set_x(begin_x, end_x), ...);
 
-		int size_x = end_x-begin_x;
-		//iteration on x-axis
-		for (int x = size_x / 4; x>0; --x)
-		{
-			f(src.get_ref()...); (src.inc_x(), ...);
-			f(src.get_ref()...); (src.inc_x(), ...);
-			f(src.get_ref()...); (src.inc_x(), ...);
-			f(src.get_ref()...); (src.inc_x(), ...);
-		}
-		if (size_x & 2)
-		{
-			f(src.get_ref()...); (src.inc_x(), ...);
-			f(src.get_ref()...); (src.inc_x(), ...);
-		}
-		if (size_x & 1)
-		{
-			f(src.get_ref()...); (src.inc_x(), ...);
-		}
+		f(end_x-begin_x, src...);
 	}
+}
 
+/**
+ * Universal blit function implementation.
+ * @param f called function.
+ * @param src source surfaces control objects.
+ */
+template<typename Func, typename... SrcType>
+static inline void ShaderDrawImpl(Func&& f, helper::controler<SrcType>... src)
+{
+	ShaderDrawRowsImpl(
+		[&](int size_x, helper::controler<SrcType>&... row)
+		{
+			//iteration on x-axis
+			for (int x = size_x / 4; x>0; --x)
+			{
+				f(row.get_ref()...); (row.inc_x(), ...);
+				f(row.get_ref()...); (row.inc_x(), ...);
+				f(row.get_ref()...); (row.inc_x(), ...);
+				f(row.get_ref()...); (row.inc_x(), ...);
+			}
+			if (size_x & 2)
+			{
+				f(row.get_ref()...); (row.inc_x(), ...);
+				f(row.get_ref()...); (row.inc_x(), ...);
+			}
+			if (size_x & 1)
+			{
+				f(row.get_ref()...); (row.inc_x(), ...);
+			}
+		},
+		src...
+	);
 };
 
 /**
@@ -121,6 +136,17 @@ static inline void ShaderDrawFunc(Func&& f, const SrcType&... src_frame)
 	ShaderDrawImpl(std::forward<Func>(f), helper::controler<SrcType>(src_frame)...);
 }
 
+/**
+ * Universal blit function working on whole rows, used by vectorized kernels.
+ * @param f function called with length of row and references to first pixel of row in every surface.
+ * @param src_frame destination and source surfaces modified by function.
+ */
+template<typename Func, typename... SrcType>
+static inline void ShaderDrawRows(Func&& f, const SrcType&... src_frame)
+{
+	ShaderDrawRowsImpl([&](int size_x, auto&... row){ f(size_x, row.get_ref()...); }, helper::controler<SrcType>(src_frame)...);
+}
+
 namespace helper
 {
 
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "SliceThreads.h"
+#include <algorithm>
+#include <thread>
+
+namespace OpenXcom
+{
+
+/**
+ * Process one slice of current job.
+ * @param slice Index of slice.
+ */
+void SliceThreads::runSlice(int slice)
+{
+	(*_job)(_rows * slice / _slices, _rows * (slice + 1) / _slices);
+}
+
+/**
+ * Main loop of worker thread.
+ * @param data Pointer to worker data.
+ */
+int SliceThreads::workerLoop(void* data)
+{
+	auto* worker = static_cast<Worker*>(data);
+	auto* pool = worker->pool;
+	while (true)
+	{
+		SDL_SemWait(worker->start);
+		if (pool->_quit)
+		{
+			return 0;
+		}
+		if (worker->slice < pool->_slices)
+		{
+			pool->runSlice(worker->slice);
+		}
+		SDL_SemPost(pool->_done);
+	}
+}
+
+/**
+ * Creates worker threads, one less than available cores.
+ */
+SliceThreads::SliceThreads() : _done(SDL_CreateSemaphore(0)), _job(nullptr), _rows(0), _slices(1), _quit(false)
+{
+	int threads = std::min((int)std::thread::hardware_concurrency(), MaxThreads);
+	if (_done == nullptr || threads < 2)
+	{
+		return;
+	}
+	// stable addresses, workers get pointer to its own data.
+	_workers.reserve(threads - 1);
+	for (int i = 1; i < threads; ++i)
+	{
+		Worker w = { this, nullptr, SDL_CreateSemaphore(0), i };
+		if (w.start == nullptr)
+		{
+			break;
+		}
+		_workers.push_back(w);
+		_workers.back().thread = SDL_CreateThread(workerLoop, &_workers.back());
+		if (_workers.back().thread == nullptr)
+		{
+			SDL_DestroySemaphore(w.start);
+			_workers.pop_back();
+			break;
+		}
+	}
+}
+
+/**
+ * Stops worker threads.
+ */
+SliceThreads::~SliceThreads()
+{
+	_quit = true;
+	for (auto& w : _workers)
+	{
+		SDL_SemPost(w.start);
+	}
+	for (auto& w : _workers)
+	{
+		SDL_WaitThread(w.thread, nullptr);
+		SDL_DestroySemaphore(w.start);
+	}
+	if (_done)
+	{
+		SDL_DestroySemaphore(_done);
+	}
+}
+
+/**
+ * Split rows in slices and process them in parallel, returns when every slice is done.
+ * @param rows Number of rows.
+ * @param job Function processing half-open range of rows, called from multiple threads at once.
+ */
+void SliceThreads::forEachSlice(int rows, const std::function<void(int, int)>& job)
+{
+	int slices = std::min((int)_workers.size() + 1, rows / MinSliceRows);
+	if (slices < 2)
+	{
+		job(0, rows);
+		return;
+	}
+
+	_job = &job;
+	_rows = rows;
+	_slices = slices;
+	for (auto& w : _workers)
+	{
+		SDL_SemPost(w.start);
+	}
+	runSlice(0);
+	for (size_t i = 0; i < _workers.size(); ++i)
+	{
+		SDL_SemWait(_done);
+	}
+	_job = nullptr;
+}
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <functional>
+#include <vector>
+#include <SDL_thread.h>
+
+namespace OpenXcom
+{
+
+/**
+ * Persistent pool of threads used to process horizontal slices of an image in parallel.
+ * Calling thread always process first slice, each worker one of the next ones.
+ * One pool can only run one job at once, code running on different threads need separate pools.
+ */
+class SliceThreads
+{
+	/// Minimal number of rows in one slice, smaller slices are not worth of waking up threads.
+	static constexpr int MinSliceRows = 16;
+	/// Upper limit of used threads, most image jobs are memory bound after this.
+	static constexpr int MaxThreads = 8;
+
+	struct Worker
+	{
+		SliceThreads* pool;
+		SDL_Thread* thread;
+		SDL_sem* start;
+		int slice;
+	};
+
+	std::vector<Worker> _workers;
+	SDL_sem* _done;
+	const std::function<void(int, int)>* _job;
+	int _rows, _slices;
+	bool _quit;
+
+	/// Process one slice of current job.
+	void runSlice(int slice);
+	/// Main loop of worker thread.
+	static int workerLoop(void* data);
+
+public:
+	/// Creates worker threads.
+	SliceThreads();
+	/// Stops worker threads.
+	~SliceThreads();
+	/// Split rows in slices and process them in parallel.
+	void forEachSlice(int rows, const std::function<void(int, int)>& job);
+};
+
+}
@@ -356,6 +356,16 @@ void State::blit()
 	}
 }
 
+/**
+ * Applies to the game what confirming the state with its default
+ * answer would do, without showing it. Used when nobody can answer,
+ * like in the geoscape simulation, states that only inform the player
+ * have nothing to apply.
+ */
+void State::applyDefaultOutcome()
+{
+}
+
 /**
  * Hides all the Surface child elements on display.
  */
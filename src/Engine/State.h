@@ -87,6 +87,8 @@ public:
 	virtual void think();
 	/// Blits the state to the screen.
 	virtual void blit();
+	/// Applies the default answer of the state without showing it.
+	virtual void applyDefaultOutcome();
 	/// Hides all the state surfaces.
 	void hideAll();
 	/// Shows all the state surfaces.
@@ -39,6 +39,13 @@
 #ifdef __MORPHOS__
 #include <ppcinline/exec.h>
 #endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define OXCE_BLIT_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OXCE_BLIT_NEON
+#endif
 
 namespace OpenXcom
 {
@@ -58,6 +65,103 @@ inline int GetPitch(int bpp, int width)
 	return ((bpp/8) * width + 15) & ~0xF;
 }
 
+/**
+ * Blit one row of pixels with shade, equal to helper::StandardShade.
+ * Uses SSE2 or NEON for 16 pixels at once, rest is done by scalar code.
+ * @param size Number of pixels in row.
+ * @param dest First destination pixel.
+ * @param src First source pixel.
+ * @param shade Shade offset.
+ */
+inline void BlitRowShade(int size, Uint8* dest, const Uint8* src, int shade)
+{
+	int x = 0;
+#if defined(OXCE_BLIT_SSE2)
+	const __m128i vZero = _mm_setzero_si128();
+	const __m128i vShade = _mm_set1_epi8((char)shade);
+	const __m128i vGroup = _mm_set1_epi8((char)helper::ColorGroup);
+	const __m128i vBlack = _mm_set1_epi8((char)helper::ColorShade);
+	for (; x + 16 <= size; x += 16)
+	{
+		const __m128i s = _mm_loadu_si128((const __m128i*)(src + x));
+		const __m128i d = _mm_loadu_si128((const __m128i*)(dest + x));
+		const __m128i n = _mm_add_epi8(s, vShade);
+		// pixels that do not flip over to another color, rest is black
+		const __m128i same = _mm_cmpeq_epi8(_mm_and_si128(_mm_xor_si128(n, s), vGroup), vZero);
+		const __m128i shaded = _mm_or_si128(_mm_and_si128(same, n), _mm_andnot_si128(same, vBlack));
+		const __m128i transparent = _mm_cmpeq_epi8(s, vZero);
+		_mm_storeu_si128((__m128i*)(dest + x), _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, shaded)));
+	}
+#elif defined(OXCE_BLIT_NEON)
+	const uint8x16_t vZero = vdupq_n_u8(0);
+	const uint8x16_t vShade = vdupq_n_u8((Uint8)shade);
+	const uint8x16_t vGroup = vdupq_n_u8(helper::ColorGroup);
+	const uint8x16_t vBlack = vdupq_n_u8(helper::ColorShade);
+	for (; x + 16 <= size; x += 16)
+	{
+		const uint8x16_t s = vld1q_u8(src + x);
+		const uint8x16_t d = vld1q_u8(dest + x);
+		const uint8x16_t n = vaddq_u8(s, vShade);
+		const uint8x16_t same = vceqq_u8(vandq_u8(veorq_u8(n, s), vGroup), vZero);
+		const uint8x16_t shaded = vbslq_u8(same, n, vBlack);
+		vst1q_u8(dest + x, vbslq_u8(vceqq_u8(s, vZero), d, shaded));
+	}
+#endif
+	for (; x < size; ++x)
+	{
+		helper::StandardShade::func(dest[x], src[x], shade);
+	}
+}
+
+/**
+ * Blit one row of pixels with shade and new base color, equal to helper::ColorReplace.
+ * @param size Number of pixels in row.
+ * @param dest First destination pixel.
+ * @param src First source pixel.
+ * @param shade Shade offset.
+ * @param newColor New color group already shifted to upper half of byte.
+ */
+inline void BlitRowColorReplace(int size, Uint8* dest, const Uint8* src, int shade, int newColor)
+{
+	int x = 0;
+#if defined(OXCE_BLIT_SSE2)
+	const __m128i vZero = _mm_setzero_si128();
+	const __m128i vShade = _mm_set1_epi8((char)shade);
+	const __m128i vColor = _mm_set1_epi8((char)newColor);
+	const __m128i vGroup = _mm_set1_epi8((char)helper::ColorGroup);
+	const __m128i vBlack = _mm_set1_epi8((char)helper::ColorShade);
+	for (; x + 16 <= size; x += 16)
+	{
+		const __m128i s = _mm_loadu_si128((const __m128i*)(src + x));
+		const __m128i d = _mm_loadu_si128((const __m128i*)(dest + x));
+		const __m128i n = _mm_add_epi8(_mm_and_si128(s, vBlack), vShade);
+		const __m128i same = _mm_cmpeq_epi8(_mm_and_si128(n, vGroup), vZero);
+		const __m128i shaded = _mm_or_si128(_mm_and_si128(same, _mm_or_si128(n, vColor)), _mm_andnot_si128(same, vBlack));
+		const __m128i transparent = _mm_cmpeq_epi8(s, vZero);
+		_mm_storeu_si128((__m128i*)(dest + x), _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, shaded)));
+	}
+#elif defined(OXCE_BLIT_NEON)
+	const uint8x16_t vZero = vdupq_n_u8(0);
+	const uint8x16_t vShade = vdupq_n_u8((Uint8)shade);
+	const uint8x16_t vColor = vdupq_n_u8((Uint8)newColor);
+	const uint8x16_t vGroup = vdupq_n_u8(helper::ColorGroup);
+	const uint8x16_t vBlack = vdupq_n_u8(helper::ColorShade);
+	for (; x + 16 <= size; x += 16)
+	{
+		const uint8x16_t s = vld1q_u8(src + x);
+		const uint8x16_t d = vld1q_u8(dest + x);
+		const uint8x16_t n = vaddq_u8(vandq_u8(s, vBlack), vShade);
+		const uint8x16_t same = vceqq_u8(vandq_u8(n, vGroup), vZero);
+		const uint8x16_t shaded = vbslq_u8(same, vorrq_u8(n, vColor), vBlack);
+		vst1q_u8(dest + x, vbslq_u8(vceqq_u8(s, vZero), d, shaded));
+	}
+#endif
+	for (; x < size; ++x)
+	{
+		helper::ColorReplace::func(dest[x], src[x], shade, newColor);
+	}
+}
+
 
 /**
  * Raw copy without any change of pixel index value between two SDL surface, palette is ignored
@@ -949,11 +1053,23 @@ void Surface::blitRaw(SurfaceRaw<Uint8> destSurf, SurfaceRaw<const Uint8> srcSur
 	{
 		--newBaseColor;
 		newBaseColor <<= 4;
-		ShaderDraw<helper::ColorReplace>(ShaderSurface(destSurf), src, ShaderScalar(shade), ShaderScalar(newBaseColor));
+		ShaderDrawRows(
+			[&](int size, Uint8& destRow, const Uint8& srcRow)
+			{
+				BlitRowColorReplace(size, &destRow, &srcRow, shade, newBaseColor);
+			},
+			ShaderSurface(destSurf), src
+		);
 	}
 	else
 	{
-		ShaderDraw<helper::StandardShade>(ShaderSurface(destSurf), src, ShaderScalar(shade));
+		ShaderDrawRows(
+			[&](int size, Uint8& destRow, const Uint8& srcRow)
+			{
+				BlitRowShade(size, &destRow, &srcRow, shade);
+			},
+			ShaderSurface(destSurf), src
+		);
 	}
 }
 
@@ -988,7 +1104,13 @@ void Surface::blitNShade(SurfaceRaw<Uint8> surface, int x, int y, int shade, Gra
 
 	dest.setDomain(range);
 
-	ShaderDraw<helper::StandardShade>(dest, src, ShaderScalar(shade));
+	ShaderDrawRows(
+		[&](int size, Uint8& destRow, const Uint8& srcRow)
+		{
+			BlitRowShade(size, &destRow, &srcRow, shade);
+		},
+		dest, src
+	);
 }
 
 /**
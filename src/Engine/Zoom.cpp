@@ -23,6 +23,7 @@
 #include "Logger.h"
 #include "Options.h"
 #include "Screen.h"
+#include "SliceThreads.h"
 
 #include "OpenGL.h"
 
@@ -37,6 +38,7 @@
 
 #include "Scalers/xbrz.h"
 
+
 #if (_MSC_VER >= 1400) || (defined(__MINGW32__) && defined(__SSE2__))
 
 #ifndef __SSE2__
@@ -61,6 +63,73 @@
 namespace OpenXcom
 {
 
+namespace
+{
+
+/**
+ * Get shared pool of scaler threads.
+ */
+SliceThreads& getScalerThreads()
+{
+	static SliceThreads threads;
+	return threads;
+}
+
+/**
+ * Get intermediate surface used for scaling when screen have black bands.
+ * Surface is kept between frames and only recreated when its size or format change.
+ * @param dst Final screen surface.
+ * @param width Width of scaled image.
+ * @param height Height of scaled image.
+ */
+SDL_Surface* getScaledBuffer(SDL_Surface* dst, int width, int height)
+{
+	static Surface::UniqueSurfacePtr buffer;
+	static Uint32 bufferFlags = 0;
+	if (!buffer || buffer->w != width || buffer->h != height || buffer->format->BitsPerPixel != dst->format->BitsPerPixel || bufferFlags != dst->flags)
+	{
+		buffer = Surface::NewSdlSurface(SDL_CreateRGBSurface(dst->flags, width, height, dst->format->BitsPerPixel, 0, 0, 0, 0));
+		bufferFlags = dst->flags;
+	}
+	return buffer.get();
+}
+
+/**
+ * Convert 8-bit palette surface directly to 32-bit surface.
+ * @param src Source 8-bit surface.
+ * @param dst Destination 32-bit surface.
+ * @return False if surfaces have other formats and nothing was done.
+ */
+bool convertPalette(SDL_Surface* src, SDL_Surface* dst)
+{
+	if (src->format->BytesPerPixel != 1 || src->format->palette == nullptr || dst->format->BytesPerPixel != 4)
+	{
+		return false;
+	}
+
+	Uint32 colors[256] = { };
+	const SDL_Palette* palette = src->format->palette;
+	for (int i = 0; i < palette->ncolors && i < 256; ++i)
+	{
+		colors[i] = SDL_MapRGB(dst->format, palette->colors[i].r, palette->colors[i].g, palette->colors[i].b);
+	}
+
+	const int width = std::min(src->w, dst->w);
+	const int height = std::min(src->h, dst->h);
+	for (int y = 0; y < height; ++y)
+	{
+		const Uint8* s = (const Uint8*)src->pixels + y * src->pitch;
+		Uint32* d = (Uint32*)((Uint8*)dst->pixels + y * dst->pitch);
+		for (int x = 0; x < width; ++x)
+		{
+			d[x] = colors[s[x]];
+		}
+	}
+	return true;
+}
+
+} //namespace
+
 
 /**
  * Optimized 8-bit zoomer for resizing by a factor of 2. Doesn't flip.
@@ -674,7 +743,11 @@ void Zoom::flipWithZoom(SDL_Surface *src, SDL_Surface *dst, int topBlackBand, in
 #ifndef __NO_OPENGL
 		if (glOut->buffer_surface)
 		{
-			SDL_BlitSurface(src, 0, glOut->surface.get(), 0); // TODO; this is less than ideal...
+			// palette is expanded straight into texture upload buffer.
+			if (!convertPalette(src, glOut->surface.get()))
+			{
+				SDL_BlitSurface(src, 0, glOut->surface.get(), 0);
+			}
 
 			glOut->refresh(glOut->linear, glOut->iwidth, glOut->iheight, dst->w, dst->h, topBlackBand, bottomBlackBand, leftBlackBand, rightBlackBand);
 			SDL_GL_SwapBuffers();
@@ -692,7 +765,7 @@ void Zoom::flipWithZoom(SDL_Surface *src, SDL_Surface *dst, int topBlackBand, in
 	}
 	else
 	{
-		SDL_Surface *tmp = SDL_CreateRGBSurface(dst->flags, dstWidth, dstHeight, dst->format->BitsPerPixel, 0, 0, 0, 0);
+		SDL_Surface *tmp = getScaledBuffer(dst, dstWidth, dstHeight);
 		_zoomSurfaceY(src, tmp, 0, 0);
 		if (src->format->palette != NULL)
 		{
@@ -700,7 +773,6 @@ void Zoom::flipWithZoom(SDL_Surface *src, SDL_Surface *dst, int topBlackBand, in
 		}
 		SDL_Rect dstrect = {(Sint16)leftBlackBand, (Sint16)topBlackBand, (Uint16)tmp->w, (Uint16)tmp->h};
 		SDL_BlitSurface(tmp, NULL, dst, &dstrect);
-		SDL_FreeSurface(tmp);
 	}
 }
 
@@ -738,7 +810,12 @@ int Zoom::_zoomSurfaceY(SDL_Surface * src, SDL_Surface * dst, int flipx, int fli
 			{
 				if (dst->w == src->w * (int)factor && dst->h == src->h * (int)factor)
 				{
-					xbrz::scale(factor, (uint32_t*)src->pixels, (uint32_t*)dst->pixels, src->w, src->h, xbrz::RGB);
+					getScalerThreads().forEachSlice(src->h,
+						[&](int yFirst, int yLast)
+						{
+							xbrz::scale(factor, (uint32_t*)src->pixels, (uint32_t*)dst->pixels, src->w, src->h, xbrz::RGB, xbrz::ScalerCfg(), yFirst, yLast);
+						}
+					);
 					return 0;
 				}
 			}
@@ -758,19 +835,34 @@ int Zoom::_zoomSurfaceY(SDL_Surface * src, SDL_Surface * dst, int flipx, int fli
 
 			if (dst->w == src->w * 2 && dst->h == src->h * 2)
 			{
-				hq2x_32_rb((uint32_t*)src->pixels, src->pitch, (uint32_t*)dst->pixels, dst->pitch, src->w, src->h);
+				getScalerThreads().forEachSlice(src->h,
+					[&](int yFirst, int yLast)
+					{
+						hq2x_32_rb_slice((uint32_t*)src->pixels, src->pitch, (uint32_t*)dst->pixels, dst->pitch, src->w, src->h, yFirst, yLast);
+					}
+				);
 				return 0;
 			}
 
 			if (dst->w == src->w * 3 && dst->h == src->h * 3)
 			{
-				hq3x_32_rb((uint32_t*)src->pixels, src->pitch, (uint32_t*)dst->pixels, dst->pitch, src->w, src->h);
+				getScalerThreads().forEachSlice(src->h,
+					[&](int yFirst, int yLast)
+					{
+						hq3x_32_rb_slice((uint32_t*)src->pixels, src->pitch, (uint32_t*)dst->pixels, dst->pitch, src->w, src->h, yFirst, yLast);
+					}
+				);
 				return 0;
 			}
 
 			if (dst->w == src->w * 4 && dst->h == src->h * 4)
 			{
-				hq4x_32_rb((uint32_t*)src->pixels, src->pitch, (uint32_t*)dst->pixels, dst->pitch, src->w, src->h);
+				getScalerThreads().forEachSlice(src->h,
+					[&](int yFirst, int yLast)
+					{
+						hq4x_32_rb_slice((uint32_t*)src->pixels, src->pitch, (uint32_t*)dst->pixels, dst->pitch, src->w, src->h, yFirst, yLast);
+					}
+				);
 				return 0;
 			}
 		}
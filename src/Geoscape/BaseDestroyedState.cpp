@@ -166,6 +166,19 @@ void BaseDestroyedState::btnOkClick(Action *)
 		return;
 	}
 
+	applyDefaultOutcome();
+}
+
+/**
+ * Removes the destroyed base from the game, damaged bases are kept.
+ */
+void BaseDestroyedState::applyDefaultOutcome()
+{
+	if (_partialDestruction)
+	{
+		return;
+	}
+
 	for (auto xbaseIt = _game->getSavedGame()->getBases()->begin(); xbaseIt != _game->getSavedGame()->getBases()->end(); ++xbaseIt)
 	{
 		Base* xbase = (*xbaseIt);
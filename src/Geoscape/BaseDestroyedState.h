@@ -49,6 +49,8 @@ public:
 	~BaseDestroyedState();
 	/// Handler for clicking the Cydonia mission button.
 	void btnOkClick(Action *action);
+	/// Removes the destroyed base from the game without showing the state.
+	void applyDefaultOutcome() override;
 
 };
 
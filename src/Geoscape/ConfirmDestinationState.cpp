@@ -410,7 +410,7 @@ void ConfirmDestinationState::btnOkClick(Action *)
 			craft->setIsAutoPatrolling(false);
 		}
 
-		craft->setStatus("STR_OUT");
+		craft->setStatus(Craft::STATUS_OUT);
 	}
 
 	_game->popState();
@@ -476,7 +476,7 @@ void ConfirmDestinationState::btnTransferClick(Action *)
 		targetBase->getCrafts()->push_back(_crafts.front());
 		_crafts.front()->setBase(targetBase, false);
 		_crafts.front()->returnToBase();
-		_crafts.front()->setStatus("STR_OUT");
+		_crafts.front()->setStatus(Craft::STATUS_OUT);
 		if (_crafts.front()->getFuel() <= _crafts.front()->getFuelLimit(targetBase))
 		{
 			_crafts.front()->setLowFuel(true);
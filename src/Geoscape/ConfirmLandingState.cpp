@@ -323,6 +323,14 @@ void ConfirmLandingState::btnNoClick(Action *)
 	_game->popState();
 }
 
+/**
+ * Declines the landing, the craft returns to base.
+ */
+void ConfirmLandingState::applyDefaultOutcome()
+{
+	_craft->returnToBase();
+}
+
 /**
  * Toggles No/Patrol button.
  * @param action Pointer to an action.
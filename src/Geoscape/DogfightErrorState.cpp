@@ -103,4 +103,12 @@ void DogfightErrorState::btnBaseClick(Action *)
 	_game->popState();
 }
 
+/**
+ * Sends the craft back to base instead of continuing the interception.
+ */
+void DogfightErrorState::applyDefaultOutcome()
+{
+	_craft->returnToBase();
+}
+
 }
@@ -48,6 +48,8 @@ public:
 	void btnInterceptClick(Action *action);
 	/// Handler for clicking the Return To Base button.
 	void btnBaseClick(Action *action);
+	/// Sends the craft back to base without showing the state.
+	void applyDefaultOutcome() override;
 };
 
 }
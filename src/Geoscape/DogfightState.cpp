@@ -1993,12 +1993,21 @@ void DogfightState::aggressiveDistance()
 
 /**
  * Updates the status text and restarts
- * the text timeout counter.
+ * the text timeout counter. While minimized
+ * the text is only laid out once restored.
  * @param status New status text.
  */
 void DogfightState::setStatus(const std::string &status)
 {
-	_txtStatus->setText(tr(status));
+	if (_minimized)
+	{
+		// the text is hidden, don't lay it out on every tick
+		_pendingStatus = status;
+	}
+	else
+	{
+		_txtStatus->setText(tr(status));
+	}
 	_timeout = 50;
 }
 
@@ -2478,6 +2487,11 @@ void DogfightState::setMinimized(const bool minimized)
 	if (!minimized)
 	{
 		updateOceanIndicator();
+		if (!_pendingStatus.empty())
+		{
+			_txtStatus->setText(tr(_pendingStatus));
+			_pendingStatus.clear();
+		}
 	}
 
 	// set these to the same as the incoming minimized state
@@ -64,6 +64,8 @@ private:
 	bool _end, _endUfoHandled, _endCraftHandled, _ufoBreakingOff, _destroyUfo, _destroyCraft, _weaponEnabled[RuleCraft::WeaponMax];
 	bool _minimized, _endDogfight, _animatingHit, _waitForPoly, _waitForAltitude;
 	std::vector<CraftWeaponProjectile*> _projectiles;
+	/// Status set while minimized, laid out only when the window is restored.
+	std::string _pendingStatus;
 	static const int _ufoBlobs[8][13][13];
 	static const int _projectileBlobs[4][6][3];
 	int _ufoSize, _ufoBlobSize, _craftHeight, _currentCraftDamageColor, _interceptionNumber;
@@ -323,8 +323,17 @@ GeoscapeCraftState::~GeoscapeCraftState()
 void GeoscapeCraftState::btnBaseClick(Action *)
 {
 	_game->popState();
+	applyDefaultOutcome();
+}
+
+/**
+ * Sends the craft back to its base and cancels auto-patrol.
+ */
+void GeoscapeCraftState::applyDefaultOutcome()
+{
 	_craft->returnToBase();
 	delete _waypoint;
+	_waypoint = 0;
 	if (_craft->getRules()->canAutoPatrol())
 	{
 		// cancel auto-patrol
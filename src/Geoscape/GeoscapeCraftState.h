@@ -57,6 +57,8 @@ public:
 	~GeoscapeCraftState();
 	/// Handler for clicking the Return To Base button.
 	void btnBaseClick(Action *action);
+	/// Sends the craft back to base without showing the state.
+	void applyDefaultOutcome() override;
 	/// Handler for clicking the Select New Target button.
 	void btnTargetClick(Action *action);
 	/// Handler for clicking the Patrol button.
@@ -376,7 +376,7 @@ void GeoscapeEventState::eventLogic()
 					for (auto* xcraft : *xbase->getCrafts())
 					{
 						int cQty = xcraft->getItems()->getItem(r);
-						if (cQty > 0 && xcraft->getStatus() != "STR_OUT")
+						if (cQty > 0 && xcraft->getStatus() != Craft::STATUS_OUT)
 						{
 							int toRemove = std::min(cQty, ti.second);
 							xcraft->getItems()->removeItem(r, toRemove);
@@ -424,7 +424,7 @@ void GeoscapeEventState::eventLogic()
 		else
 		{
 			// same as buy
-			craft->setStatus("STR_REFUELLING");
+			craft->setStatus(Craft::STATUS_REFUELLING);
 			Transfer* t = new Transfer(1);
 			t->setCraft(craft);
 			hq->getTransfers()->push_back(t);
@@ -549,12 +549,7 @@ void GeoscapeEventState::btnOkClick(Action *)
 	if (!_eventRule.getCutscene().empty())
 	{
 		_game->pushState(new CutsceneState(_eventRule.getCutscene()));
-		if (_game->getSavedGame()->getEnding() == END_NONE)
-		{
-			const RuleVideo* videoRule = _game->getMod()->getVideo(_eventRule.getCutscene(), true);
-			if (videoRule->getWinGame()) _game->getSavedGame()->setEnding(END_WIN);
-			if (videoRule->getLoseGame()) _game->getSavedGame()->setEnding(END_LOSE);
-		}
+		applyDefaultOutcome();
 	}
 
 	if (_game->getSavedGame()->getEnding() == END_NONE)
@@ -577,6 +572,19 @@ void GeoscapeEventState::btnOkClick(Action *)
 	}
 }
 
+/**
+ * Ends the game if the event cutscene is marked to win or lose it.
+ */
+void GeoscapeEventState::applyDefaultOutcome()
+{
+	if (!_eventRule.getCutscene().empty() && _game->getSavedGame()->getEnding() == END_NONE)
+	{
+		const RuleVideo* videoRule = _game->getMod()->getVideo(_eventRule.getCutscene(), true);
+		if (videoRule->getWinGame()) _game->getSavedGame()->setEnding(END_WIN);
+		if (videoRule->getLoseGame()) _game->getSavedGame()->setEnding(END_LOSE);
+	}
+}
+
 /**
  * Toggles the view between the description and the ItemsArriving list.
  * @param action Pointer to an action.
@@ -59,6 +59,8 @@ public:
 	void init() override;
 	/// Handler for clicking the OK button.
 	void btnOkClick(Action *action);
+	/// Ends the game if the event cutscene says so, without showing the state.
+	void applyDefaultOutcome() override;
 	/// Handler for clicking the ItemsArriving button.
 	void btnItemsArrivingClick(Action *action);
 };
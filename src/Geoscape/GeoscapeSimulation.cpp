@@ -0,0 +1,206 @@
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "GeoscapeSimulation.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include "../Engine/CrossPlatform.h"
+#include "../Engine/Logger.h"
+#include "../Engine/Options.h"
+#include "../Engine/RNG.h"
+#include "../Savegame/SavedGame.h"
+#include "../Savegame/Base.h"
+
+namespace OpenXcom
+{
+
+namespace
+{
+
+const char *HandlerNames[GeoscapeSimulation::HANDLERS] = { "5sec", "10min", "30min", "1hour", "1day", "1month" };
+
+const char *BattlePolicyNames[] = { "hold", "lose" };
+
+/**
+ * Gets duration in milliseconds.
+ */
+double toMs(std::chrono::steady_clock::duration duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} //namespace
+
+/**
+ * Starts measuring handler.
+ * @param simulation Simulation collecting the time.
+ * @param handler Measured time handler.
+ */
+GeoscapeSimulation::Scope::Scope(GeoscapeSimulation *simulation, TimeTrigger handler) : _simulation(simulation), _handler(handler), _start(std::chrono::steady_clock::now())
+{
+}
+
+/**
+ * Adds measured time to current day.
+ */
+GeoscapeSimulation::Scope::~Scope()
+{
+	_simulation->_dayTimes[_handler] += toMs(std::chrono::steady_clock::now() - _start);
+	_simulation->_calls[_handler]++;
+}
+
+/**
+ * Starts a simulation of the given number of days.
+ * @param days Number of game days to simulate.
+ * @param seed Random seed, 0 keeps the current one.
+ * @param battles Name of the battle policy.
+ * @param save Simulated game.
+ */
+GeoscapeSimulation::GeoscapeSimulation(int days, uint64_t seed, const std::string &battles, SavedGame *save) :
+	_days(days), _daysDone(0), _dayTimes(), _totalTimes(), _calls(),
+	_totalWall(0.0), _minDay(std::numeric_limits<double>::max()), _maxDay(0.0),
+	_battlePolicy(BATTLES_HOLD), _popups(0), _interceptions(0), _baseDefenses(0),
+	_startFunds(save->getFunds()), _filename(Options::getUserFolder() + "simulation.csv")
+{
+	if (seed != 0)
+	{
+		RNG::setSeed(seed);
+	}
+	auto policy = std::find(std::begin(BattlePolicyNames), std::end(BattlePolicyNames), battles);
+	if (policy != std::end(BattlePolicyNames))
+	{
+		_battlePolicy = (BattlePolicy)(policy - std::begin(BattlePolicyNames));
+	}
+	else
+	{
+		Log(LOG_ERROR) << "Unknown simulation battle policy " << battles << ", using " << BattlePolicyNames[_battlePolicy];
+	}
+	Log(LOG_INFO) << "Simulating " << _days << " days of geoscape, seed " << RNG::getSeed() << ", base defenses " << BattlePolicyNames[_battlePolicy];
+
+	std::ofstream out(_filename, std::ios::trunc);
+	if (!out)
+	{
+		Log(LOG_WARNING) << "Failed to write simulation timings to " << _filename;
+		return;
+	}
+	out << "day,date,wall_ms";
+	for (auto* name : HandlerNames)
+	{
+		out << "," << name << "_ms";
+	}
+	out << ",funds,bases,ufos\n";
+}
+
+/**
+ * Starts measuring next day.
+ */
+void GeoscapeSimulation::startDay()
+{
+	_dayTimes.fill(0.0);
+	_dayStart = std::chrono::steady_clock::now();
+}
+
+/**
+ * Finishes measuring current day.
+ * @param save Simulated game.
+ * @return True when all days are done or the game has ended.
+ */
+bool GeoscapeSimulation::endDay(SavedGame *save)
+{
+	const double wall = toMs(std::chrono::steady_clock::now() - _dayStart);
+	_daysDone++;
+	_totalWall += wall;
+	_minDay = std::min(_minDay, wall);
+	_maxDay = std::max(_maxDay, wall);
+	for (int i = 0; i < HANDLERS; ++i)
+	{
+		_totalTimes[i] += _dayTimes[i];
+	}
+	exportDay(save, wall);
+	return _daysDone >= _days || save->getEnding() != END_NONE;
+}
+
+/**
+ * Writes one simulated day to the csv file.
+ * @param save Simulated game.
+ * @param wall Wall time of the day in milliseconds.
+ */
+void GeoscapeSimulation::exportDay(SavedGame *save, double wall)
+{
+	std::ofstream out(_filename, std::ios::app);
+	if (!out)
+	{
+		return;
+	}
+	const GameTime *time = save->getTime();
+	out << _daysDone << "," << time->getYear() << "-" << time->getMonth() << "-" << time->getDay();
+	out << std::fixed << std::setprecision(3) << "," << wall;
+	for (double ms : _dayTimes)
+	{
+		out << "," << ms;
+	}
+	out << "," << save->getFunds() << "," << save->getBases()->size() << "," << save->getUfos()->size() << "\n";
+}
+
+/**
+ * Writes totals and the economy summary to the log.
+ * @param save Simulated game.
+ */
+void GeoscapeSimulation::report(SavedGame *save) const
+{
+	if (_daysDone == 0)
+	{
+		return;
+	}
+
+	std::ostringstream handlers;
+	handlers << std::fixed << std::setprecision(3);
+	for (int i = 0; i < HANDLERS; ++i)
+	{
+		handlers << " " << HandlerNames[i] << "=" << _totalTimes[i] << "ms/" << _calls[i];
+	}
+	Log(LOG_INFO) << "Simulated " << _daysDone << " days in " << _totalWall << "ms, per day avg/min/max: "
+		<< _totalWall / _daysDone << "/" << _minDay << "/" << _maxDay << "ms";
+	Log(LOG_INFO) << "Time handlers (total/calls):" << handlers.str();
+	Log(LOG_INFO) << "Battle policy: no ground missions or interceptions, landings declined, base defenses "
+		<< (_battlePolicy == BATTLES_HOLD ? "held by garrisoned bases" : "always lost");
+	Log(LOG_INFO) << "Unanswered: " << _popups << " popups, " << _interceptions << " interceptions, "
+		<< _baseDefenses << " base defenses";
+
+	size_t soldiers = 0, crafts = 0;
+	int scientists = 0, engineers = 0;
+	for (auto* xbase : *save->getBases())
+	{
+		soldiers += xbase->getSoldiers()->size();
+		crafts += xbase->getCrafts()->size();
+		scientists += xbase->getTotalScientists();
+		engineers += xbase->getTotalEngineers();
+	}
+	Log(LOG_INFO) << "Economy: funds " << _startFunds << " -> " << save->getFunds()
+		<< ", funding " << save->getCountryFunding() << ", maintenance " << save->getBaseMaintenance()
+		<< ", bases " << save->getBases()->size() << ", soldiers " << soldiers << ", crafts " << crafts
+		<< ", scientists " << scientists << ", engineers " << engineers
+		<< ", researched " << save->getDiscoveredResearch().size();
+	Log(LOG_INFO) << "Aliens: " << save->getUfos()->size() << " ufos, " << save->getAlienBases()->size() << " bases, "
+		<< save->getAlienMissions().size() << " missions, month score " << save->getCurrentScore(save->getMonthsPassed() + 1);
+}
+
+}
@@ -0,0 +1,94 @@
+#pragma once
+/*
+ * Copyright 2010-2016 OpenXcom Developers.
+ *
+ * This file is part of OpenXcom.
+ *
+ * OpenXcom is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * OpenXcom is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "../Savegame/GameTime.h"
+
+namespace OpenXcom
+{
+
+class SavedGame;
+
+/**
+ * Measures a headless fast-forward of a geoscape save, started with `-simulate DAYS`.
+ * Nobody answers the game while it runs: popups apply their default answer unseen,
+ * landings and interceptions are called off and no battle is fought, base defenses
+ * end by the battle policy given with `-simulateBattles`.
+ * Timings of every simulated day go to `simulation.csv` in user folder,
+ * totals and the state of the economy to the log.
+ */
+class GeoscapeSimulation
+{
+public:
+	/// Number of measured time handlers, one per time trigger.
+	static constexpr int HANDLERS = TIME_1MONTH + 1;
+	/// Outcome of base defenses, there is no battlescape to fight them.
+	enum BattlePolicy { BATTLES_HOLD, BATTLES_LOSE };
+
+	/**
+	 * Measures time of one time handler while in scope.
+	 */
+	class Scope
+	{
+		GeoscapeSimulation *_simulation;
+		TimeTrigger _handler;
+		std::chrono::steady_clock::time_point _start;
+	public:
+		/// Starts measuring handler.
+		Scope(GeoscapeSimulation *simulation, TimeTrigger handler);
+		/// Adds measured time to current day.
+		~Scope();
+	};
+
+private:
+	int _days, _daysDone;
+	std::array<double, HANDLERS> _dayTimes, _totalTimes;
+	std::array<int, HANDLERS> _calls;
+	double _totalWall, _minDay, _maxDay;
+	BattlePolicy _battlePolicy;
+	int _popups, _interceptions, _baseDefenses;
+	int64_t _startFunds;
+	std::string _filename;
+	std::chrono::steady_clock::time_point _dayStart;
+
+	/// Writes one simulated day to the csv file.
+	void exportDay(SavedGame *save, double wall);
+public:
+	/// Starts a simulation of the given number of days.
+	GeoscapeSimulation(int days, uint64_t seed, const std::string &battles, SavedGame *save);
+	/// Gets outcome of base defenses.
+	BattlePolicy getBattlePolicy() const { return _battlePolicy; }
+	/// Starts measuring next day.
+	void startDay();
+	/// Finishes measuring current day, returns true when no more days should be simulated.
+	bool endDay(SavedGame *save);
+	/// Writes totals and the economy summary to the log.
+	void report(SavedGame *save) const;
+	/// Counts a popup answered by its default outcome.
+	void addPopup() { _popups++; }
+	/// Counts a called off interception.
+	void addInterception() { _interceptions++; }
+	/// Counts a base defense resolved without a battle.
+	void addBaseDefense() { _baseDefenses++; }
+};
+
+}
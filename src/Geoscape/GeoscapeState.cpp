@@ -88,6 +88,7 @@
 #include "CraftErrorState.h"
 #include "DogfightErrorState.h"
 #include "DogfightExperienceState.h"
+#include "GeoscapeSimulation.h"
 #include "../Ufopaedia/Ufopaedia.h"
 #include "../Savegame/ResearchProject.h"
 #include "ResearchCompleteState.h"
@@ -143,7 +144,7 @@ namespace OpenXcom
  * Initializes all the elements in the Geoscape screen.
  * @param game Pointer to the core game.
  */
-GeoscapeState::GeoscapeState() : _pause(false), _zoomInEffectDone(false), _zoomOutEffectDone(false), _minimizedDogfights(0), _slowdownCounter(0)
+GeoscapeState::GeoscapeState() : _pause(false), _zoomInEffectDone(false), _zoomOutEffectDone(false), _minimizedDogfights(0), _slowdownCounter(0), _simulation(0)
 {
 	int screenWidth = Options::baseXGeoscape;
 	int screenHeight = Options::baseYGeoscape;
@@ -499,6 +500,7 @@ GeoscapeState::~GeoscapeState()
 		delete dfs;
 	}
 	_dogfightsToBeStarted.clear();
+	delete _simulation;
 }
 
 /**
@@ -705,6 +707,11 @@ void GeoscapeState::handle(Action *action)
 void GeoscapeState::init()
 {
 	State::init();
+	if (Options::getSimulateDays() > 0 && _simulation == 0)
+	{
+		_simulation = new GeoscapeSimulation(Options::getSimulateDays(), Options::getSimulateSeed(), Options::getSimulateBattles(), _game->getSavedGame());
+		_game->setHeadless(true);
+	}
 	timeDisplay();
 	updateSlackingIndicator();
 
@@ -759,6 +766,12 @@ void GeoscapeState::think()
 {
 	State::think();
 
+	if (_simulation != 0)
+	{
+		simulateDay();
+		return;
+	}
+
 	_zoomInEffectTimer->think(this, 0);
 	_zoomOutEffectTimer->think(this, 0);
 	_dogfightStartTimer->think(this, 0);
@@ -889,6 +902,8 @@ void GeoscapeState::timeAdvance()
 
 	for (int i = 0; i < timeSpan && !_pause; ++i)
 	{
+		i += skipQuietTicks(timeSpan - i - 1);
+
 		TimeTrigger trigger;
 		trigger = _game->getSavedGame()->getTime()->advance();
 		switch (trigger)
@@ -919,6 +934,186 @@ void GeoscapeState::timeAdvance()
 	_globe->draw();
 }
 
+/**
+ * Skips following 5 second ticks if every one of them would only advance the clock and countdowns.
+ * This is the case when nothing flies (no flying UFOs, no craft on the move, no dogfights),
+ * nothing waits for a one-off update (destroyed UFOs and craft, unused waypoints, recharging shields)
+ * and no landed UFO is about to lift off. Ticks are only skipped up to the next 10 minute
+ * handler and the tick that triggers it is left to the caller, so all events are processed at the same game time as before.
+ * @param limit Maximum number of ticks to skip.
+ * @return Number of skipped ticks.
+ */
+int GeoscapeState::skipQuietTicks(int limit)
+{
+	SavedGame *save = _game->getSavedGame();
+	GameTime *time = save->getTime();
+
+	// the tick reaching next 10 minutes is never quiet
+	int ticks = std::min(limit, ((9 - time->getMinute() % 10) * 60 + (60 - time->getSecond())) / 5 - 1);
+	if (ticks <= 0 || !_dogfights.empty() || !_dogfightsToBeStarted.empty() || save->getBases()->empty() || save->getEnding() != END_NONE)
+	{
+		return 0;
+	}
+
+	for (const auto* ufo : *save->getUfos())
+	{
+		switch (ufo->getStatus())
+		{
+		case Ufo::LANDED:
+			// the tick in which the UFO lifts off must run normally
+			ticks = std::min(ticks, (int)(ufo->getSecondsRemaining() / 5) - 1);
+			break;
+		case Ufo::CRASHED:
+			if (!ufo->getDetected() || ufo->getSecondsRemaining() == 0)
+			{
+				return 0;
+			}
+			break;
+		case Ufo::IGNORE_ME:
+			break;
+		default:
+			return 0;
+		}
+		if (ticks <= 0)
+		{
+			return 0;
+		}
+	}
+
+	for (const auto* xbase : *save->getBases())
+	{
+		for (const auto* xcraft : *xbase->getCrafts())
+		{
+			if (!xcraft->isIdle() || xcraft->isDestroyed())
+			{
+				return 0;
+			}
+			if (xcraft->getShield() < xcraft->getCraftStats().shieldCapacity && xcraft->getCraftStats().shieldRechargeInGeoscape != 0)
+			{
+				return 0;
+			}
+		}
+	}
+
+	for (auto* way : *save->getWaypoints())
+	{
+		if (way->getFollowers()->empty())
+		{
+			return 0;
+		}
+	}
+
+	for (int i = 0; i < ticks; ++i)
+	{
+		time->advance();
+	}
+	for (auto* ufo : *save->getUfos())
+	{
+		if (ufo->getStatus() == Ufo::LANDED)
+		{
+			ufo->setSecondsRemaining(ufo->getSecondsRemaining() - ticks * 5);
+		}
+	}
+	return ticks;
+}
+
+/**
+ * Runs one game day of the headless simulation started from command line.
+ * Time handlers are called the same way as in timeAdvance, but without waiting
+ * for popups or dogfights, and the game quits after the last simulated day.
+ */
+void GeoscapeState::simulateDay()
+{
+	SavedGame *save = _game->getSavedGame();
+	_simulation->startDay();
+	bool dayPassed = false;
+	while (!dayPassed && save->getEnding() == END_NONE)
+	{
+		skipQuietTicks(12 * 60 * 24);
+
+		TimeTrigger trigger = save->getTime()->advance();
+		dayPassed = trigger >= TIME_1DAY;
+		switch (trigger)
+		{
+		case TIME_1MONTH:
+			{
+				GeoscapeSimulation::Scope scope(_simulation, TIME_1MONTH);
+				time1Month();
+			}
+			FALLTHROUGH;
+		case TIME_1DAY:
+			{
+				GeoscapeSimulation::Scope scope(_simulation, TIME_1DAY);
+				time1Day();
+			}
+			FALLTHROUGH;
+		case TIME_1HOUR:
+			{
+				GeoscapeSimulation::Scope scope(_simulation, TIME_1HOUR);
+				time1Hour();
+			}
+			FALLTHROUGH;
+		case TIME_30MIN:
+			{
+				GeoscapeSimulation::Scope scope(_simulation, TIME_30MIN);
+				time30Minutes();
+			}
+			FALLTHROUGH;
+		case TIME_10MIN:
+			{
+				GeoscapeSimulation::Scope scope(_simulation, TIME_10MIN);
+				time10Minutes();
+			}
+			FALLTHROUGH;
+		case TIME_5SEC:
+			{
+				GeoscapeSimulation::Scope scope(_simulation, TIME_5SEC);
+				time5Seconds();
+			}
+		}
+		callOffDogfights();
+	}
+	_pause = false;
+
+	if (_simulation->endDay(save))
+	{
+		_simulation->report(save);
+		_game->quit();
+	}
+}
+
+/**
+ * Calls off all interceptions during the headless simulation,
+ * there is nobody to fight them so the craft return to base.
+ */
+void GeoscapeState::callOffDogfights()
+{
+	if (_dogfights.empty() && _dogfightsToBeStarted.empty())
+	{
+		return;
+	}
+	for (auto* dogfights : { &_dogfights, &_dogfightsToBeStarted })
+	{
+		for (auto* dfs : *dogfights)
+		{
+			if (dfs->getCraft())
+			{
+				dfs->getCraft()->setInDogfight(false);
+				dfs->getCraft()->setInterceptionOrder(0);
+				dfs->getCraft()->returnToBase();
+			}
+			_simulation->addInterception();
+		}
+	}
+	Collections::deleteAll(_dogfights);
+	Collections::deleteAll(_dogfightsToBeStarted);
+	_minimizedDogfights = 0;
+	_dogfightStartTimer->stop();
+	_dogfightTimer->stop();
+	_zoomInEffectTimer->stop();
+	_zoomOutEffectTimer->stop();
+}
+
 /**
  * Update list of active crafts.
  * @return Const pointer to updated list.
@@ -930,7 +1125,7 @@ const std::vector<Craft*>* GeoscapeState::updateActiveCrafts()
 	{
 		for (auto* xcraft : *xbase->getCrafts())
 		{
-			if (xcraft->getStatus() == "STR_OUT" && !xcraft->isDestroyed())
+			if (xcraft->getStatus() == Craft::STATUS_OUT && !xcraft->isDestroyed())
 			{
 				_activeCrafts.push_back(xcraft);
 			}
@@ -1073,7 +1268,8 @@ void GeoscapeState::time5Seconds()
 					ufo->setDestination(0);
 					base->setupDefenses(mission);
 					timerReset();
-					if (!base->getDefenses()->empty() && !ufo->getMission()->getRules().ignoreBaseDefenses())
+					// base defenses wait for the player to start firing, the headless simulation skips them
+					if (_simulation == 0 && !base->getDefenses()->empty() && !ufo->getMission()->getRules().ignoreBaseDefenses())
 					{
 						bool instaHyper = ufo->getRules()->isInstaHyper() || mission->getRules().isInstaHyper();
 						popup(new BaseDefenseState(base, ufo, this, instaHyper));
@@ -1434,7 +1630,7 @@ void GeoscapeState::time5Seconds()
 				}
 				else if (x != 0)
 				{
-					if (x->getStatus() != "STR_OUT" || x->isDestroyed())
+					if (x->getStatus() != Craft::STATUS_OUT || x->isDestroyed())
 					{
 						xcraft->returnToBase();
 					}
@@ -1488,6 +1684,137 @@ void GeoscapeState::time5Seconds()
 	);
 }
 
+/**
+ * Radar sources (bases first, then active craft, in the order the UFO detection checks them)
+ * bucketed in latitude bands at least as tall as the longest radar range.
+ * A UFO can only be in range of sources from its own and both neighbouring bands,
+ * those are then tested by cheap dot product of unit vectors.
+ */
+class RadarSourceIndex
+{
+public:
+	/// Builds index of given bases and craft.
+	RadarSourceIndex(const std::vector<Base*>& bases, const std::vector<Craft*>& crafts);
+	/// Gets sources that can have the UFO in radar range.
+	void findCandidates(const Ufo* ufo, std::vector<size_t>& candidates) const;
+private:
+	struct Source
+	{
+		double x, y, z, minDot;
+	};
+	std::vector<Source> _sources;
+	std::vector<std::vector<size_t>> _bands;
+	double _bandHeight;
+
+	/// Adds source with given radar range.
+	void addSource(const Target* target, int range);
+	/// Gets band of latitude.
+	size_t getBand(double lat) const;
+};
+
+/**
+ * Builds index of radar sources.
+ * @param bases All XCOM bases.
+ * @param crafts Active XCOM craft.
+ */
+RadarSourceIndex::RadarSourceIndex(const std::vector<Base*>& bases, const std::vector<Craft*>& crafts) : _bandHeight(M_PI)
+{
+	_sources.reserve(bases.size() + crafts.size());
+	for (auto* base : bases)
+	{
+		int range = -1;
+		for (const auto* fac : *base->getFacilities())
+		{
+			if (fac->getBuildTime() == 0)
+			{
+				range = std::max(range, fac->getRules()->getRadarRange());
+			}
+		}
+		addSource(base, range);
+	}
+	for (const auto* craft : crafts)
+	{
+		addSource(craft, craft->getCraftStats().radarRange > 0 ? craft->getCraftStats().radarRange : -1);
+	}
+
+	double maxAngle = 0.0;
+	for (const auto& source : _sources)
+	{
+		maxAngle = std::max(maxAngle, acos(source.minDot));
+	}
+	if (maxAngle <= 0.0)
+	{
+		// no radar at all, nothing is ever a candidate
+		return;
+	}
+	const size_t bandCount = Clamp((int)(M_PI / maxAngle), 1, 180);
+	_bandHeight = M_PI / bandCount;
+	_bands.resize(bandCount);
+	for (size_t i = 0; i < _sources.size(); ++i)
+	{
+		if (_sources[i].minDot < 1.0)
+		{
+			_bands[getBand(asin(Clamp(_sources[i].z, -1.0, 1.0)))].push_back(i);
+		}
+	}
+}
+
+/**
+ * Adds source, its range is stored as minimal cosine of angle to target
+ * with a margin of two nautical miles for rounding in the exact distance check.
+ * @param target Base or craft.
+ * @param range Radar range in nautical miles, negative if source have no radar.
+ */
+void RadarSourceIndex::addSource(const Target* target, int range)
+{
+	Source source;
+	source.x = cos(target->getLatitude()) * cos(target->getLongitude());
+	source.y = cos(target->getLatitude()) * sin(target->getLongitude());
+	source.z = sin(target->getLatitude());
+	source.minDot = range >= 0 ? cos(std::min(Nautical(range + 2), M_PI)) : 1.0;
+	_sources.push_back(source);
+}
+
+/**
+ * Gets band of latitude.
+ * @param lat Latitude in radians.
+ * @return Band index.
+ */
+size_t RadarSourceIndex::getBand(double lat) const
+{
+	return Clamp((int)((lat + M_PI_2) / _bandHeight), 0, (int)_bands.size() - 1);
+}
+
+/**
+ * Gets sources that can have the UFO in radar range, every other source is guaranteed out of range.
+ * @param ufo Checked UFO.
+ * @param candidates Indexes of sources in order of bases then craft.
+ */
+void RadarSourceIndex::findCandidates(const Ufo* ufo, std::vector<size_t>& candidates) const
+{
+	candidates.clear();
+	if (_bands.empty())
+	{
+		return;
+	}
+	const double x = cos(ufo->getLatitude()) * cos(ufo->getLongitude());
+	const double y = cos(ufo->getLatitude()) * sin(ufo->getLongitude());
+	const double z = sin(ufo->getLatitude());
+	const size_t band = getBand(ufo->getLatitude());
+	for (size_t b = band > 0 ? band - 1 : 0; b <= band + 1 && b < _bands.size(); ++b)
+	{
+		for (size_t i : _bands[b])
+		{
+			const auto& source = _sources[i];
+			if (x * source.x + y * source.y + z * source.z >= source.minDot)
+			{
+				candidates.push_back(i);
+			}
+		}
+	}
+	std::sort(candidates.begin(), candidates.end());
+}
+
 /**
  * Functor that attempt to detect an XCOM base.
  */
@@ -1528,47 +1855,41 @@ bool DetectXCOMBase::operator()(const Ufo *ufo) const
  */
 void GeoscapeState::time10Minutes()
 {
-	for (auto* xbase : *_game->getSavedGame()->getBases())
+	// Fuel consumption for XCOM craft.
+	for (auto* xcraft : *updateActiveCrafts())
 	{
-		// Fuel consumption for XCOM craft.
-		for (auto* xcraft : *xbase->getCrafts())
+		int escortSpeed = 0;
 		{
-			if (xcraft->getStatus() == "STR_OUT")
+			Craft *escortee = dynamic_cast<Craft*>(xcraft->getDestination());
+			if (escortee != 0)
 			{
-				int escortSpeed = 0;
-				{
-					Craft *escortee = dynamic_cast<Craft*>(xcraft->getDestination());
-					if (escortee != 0)
-					{
-						if (xcraft->getDistance(escortee) < Nautical(_game->getMod()->getEscortRange()))
-						{
-							escortSpeed = escortee->getSpeed();
-						}
-					}
-				}
-				xcraft->consumeFuel(escortSpeed);
-				if (!xcraft->getLowFuel() && xcraft->getFuel() <= xcraft->getFuelLimit())
+				if (xcraft->getDistance(escortee) < Nautical(_game->getMod()->getEscortRange()))
 				{
-					xcraft->setLowFuel(true);
-					xcraft->returnToBase();
-					if (!xcraft->getIsAutoPatrolling())
-					{
-						popup(new LowFuelState(xcraft, this));
-					}
+					escortSpeed = escortee->getSpeed();
 				}
+			}
+		}
+		xcraft->consumeFuel(escortSpeed);
+		if (!xcraft->getLowFuel() && xcraft->getFuel() <= xcraft->getFuelLimit())
+		{
+			xcraft->setLowFuel(true);
+			xcraft->returnToBase();
+			if (!xcraft->getIsAutoPatrolling())
+			{
+				popup(new LowFuelState(xcraft, this));
+			}
+		}
 
-				if (xcraft->getDestination() == 0 && xcraft->getCraftStats().sightRange > 0)
+		if (xcraft->getDestination() == 0 && xcraft->getCraftStats().sightRange > 0)
+		{
+			double range = Nautical(xcraft->getCraftStats().sightRange);
+			for (auto* ab : *_game->getSavedGame()->getAlienBases())
+			{
+				if (xcraft->getDistance(ab) <= range)
 				{
-					double range = Nautical(xcraft->getCraftStats().sightRange);
-					for (auto* ab : *_game->getSavedGame()->getAlienBases())
+					if (RNG::percent(50-(xcraft->getDistance(ab) / range) * 50) && !ab->isDiscovered())
 					{
-						if (xcraft->getDistance(ab) <= range)
-						{
-							if (RNG::percent(50-(xcraft->getDistance(ab) / range) * 50) && !ab->isDiscovered())
-							{
-								ab->setDiscovered(true);
-							}
-						}
+						ab->setDiscovered(true);
 					}
 				}
 			}
@@ -1732,7 +2053,7 @@ void GeoscapeState::baseHunting()
 				for (auto craft : *activeCrafts)
 				{
 					// Craft is flying (i.e. not in base)
-					if (craft->getStatus() == "STR_OUT" && !craft->isDestroyed() && !craft->getRules()->isUndetectable() && !craft->isIgnoredByHK())
+					if (craft->getStatus() == Craft::STATUS_OUT && !craft->isDestroyed() && !craft->getRules()->isUndetectable() && !craft->isIgnoredByHK())
 					{
 						// Craft is close enough and RNG is in our favour
 						if (craft->getDistance(ab) < Nautical(ab->getDeployment()->getBaseDetectionRange()) && RNG::percent(ab->getDeployment()->getBaseDetectionChance()))
@@ -1938,20 +2259,20 @@ void GeoscapeState::time30Minutes()
 	{
 		for (auto* xcraft : *xbase->getCrafts())
 		{
-			if (xcraft->getStatus() == "STR_REFUELLING")
+			if (xcraft->getStatus() == Craft::STATUS_REFUELLING)
 			{
 				std::string item = xcraft->refuel();
 
 				if (item.empty())
 				{
 					// notification
-					if (xcraft->getStatus() == "STR_READY" && xcraft->getRules()->notifyWhenRefueled())
+					if (xcraft->getStatus() == Craft::STATUS_READY && xcraft->getRules()->notifyWhenRefueled())
 					{
 						std::string msg = tr("STR_CRAFT_IS_READY").arg(xcraft->getName(_game->getLanguage())).arg(xbase->getName());
 						popup(new CraftErrorState(this, msg));
 					}
 					// auto-patrol
-					if (xcraft->getStatus() == "STR_READY" && xcraft->getRules()->canAutoPatrol())
+					if (xcraft->getStatus() == Craft::STATUS_READY && xcraft->getRules()->canAutoPatrol())
 					{
 						if (xcraft->getIsAutoPatrolling())
 						{
@@ -1964,7 +2285,7 @@ void GeoscapeState::time30Minutes()
 								_game->getSavedGame()->getWaypoints()->push_back(w);
 							}
 							xcraft->setDestination(w);
-							xcraft->setStatus("STR_OUT");
+							xcraft->setStatus(Craft::STATUS_OUT);
 						}
 					}
 				}
@@ -1982,6 +2303,7 @@ void GeoscapeState::time30Minutes()
 
 	// can be updated by previous loop
 	auto activeCrafts = updateActiveCrafts();
+	RadarSourceIndex radarIndex(*_game->getSavedGame()->getBases(), *activeCrafts);
 
 	// hidden alien activity variables
 
@@ -2034,7 +2356,7 @@ void GeoscapeState::time30Minutes()
 
 			// detection ufo state
 
-			ufoDetection(ufo, activeCrafts);
+			ufoDetection(ufo, activeCrafts, radarIndex);
 
 			// accumulate hidden ufos
 
@@ -2204,7 +2526,7 @@ void GeoscapeState::time30Minutes()
  * Logic responsible for detecting ufo and its tracking.
  * @param ufo
  */
-void GeoscapeState::ufoDetection(Ufo* ufo, const std::vector<Craft*>* activeCrafts)
+void GeoscapeState::ufoDetection(Ufo* ufo, const std::vector<Craft*>* activeCrafts, const RadarSourceIndex& radarIndex)
 {
 	auto maskTest = [](UfoDetection value, UfoDetection mask)
 	{
@@ -2219,14 +2541,46 @@ void GeoscapeState::ufoDetection(Ufo* ufo, const std::vector<Craft*>* activeCraf
 	auto alreadyTracked = ufo->getDetected();
 	auto save = _game->getSavedGame();
 
+	// without scripts, sources out of radar range can't detect anything and are skipped,
+	// only the random number they would use is drawn to keep the same random sequence
+	const bool pruneBases = ufo->getRules()->getScript<ModScript::DetectUfoFromBase>().isEmpty();
+	const bool pruneCrafts = ufo->getRules()->getScript<ModScript::DetectUfoFromCraft>().isEmpty();
+	std::vector<size_t> candidates;
+	radarIndex.findCandidates(ufo, candidates);
+	auto candidate = candidates.begin();
+	auto isCandidate = [&](size_t index)
+	{
+		if (candidate != candidates.end() && *candidate == index)
+		{
+			++candidate;
+			return true;
+		}
+		return false;
+	};
+	size_t index = 0;
+
 	for (auto* base : *_game->getSavedGame()->getBases())
 	{
-		detected = maskBitOr(detected, base->detect(ufo, save, alreadyTracked));
+		if (isCandidate(index++) || !pruneBases)
+		{
+			detected = maskBitOr(detected, base->detect(ufo, save, alreadyTracked));
+		}
+		else
+		{
+			RNG::percent(0);
+		}
 	}
 
 	for (auto* craft : *activeCrafts)
 	{
-		detected = maskBitOr(detected, craft->detect(ufo, save, alreadyTracked));
+		if (isCandidate(index++) || !pruneCrafts)
+		{
+			detected = maskBitOr(detected, craft->detect(ufo, save, alreadyTracked));
+		}
+		else
+		{
+			RNG::percent(0);
+		}
 	}
 
 	if (!alreadyTracked)
@@ -2275,11 +2629,11 @@ void GeoscapeState::time1Hour()
 	{
 		for (auto* xcraft : *xbase->getCrafts())
 		{
-			if (xcraft->getStatus() == "STR_REPAIRS")
+			if (xcraft->getStatus() == Craft::STATUS_REPAIRS)
 			{
 				xcraft->repair();
 			}
-			else if (xcraft->getStatus() == "STR_REARMING")
+			else if (xcraft->getStatus() == Craft::STATUS_REARMING)
 			{
 				auto* ammo = xcraft->rearm();
 				if (ammo)
@@ -2291,7 +2645,7 @@ void GeoscapeState::time1Hour()
 					popup(new CraftErrorState(this, msg));
 				}
 			}
-			if (xcraft->getShieldCapacity() > 0 && xcraft->getStatus() != "STR_OUT")
+			if (xcraft->getShieldCapacity() > 0 && xcraft->getStatus() != Craft::STATUS_OUT)
 			{
 				// Recharge craft shields in parallel (no wait for repair/rearm/refuel)
 				xcraft->setShield(xcraft->getShield() + xcraft->getRules()->getShieldRechargeAtBase());
@@ -3065,6 +3419,14 @@ void GeoscapeState::timerReset()
  */
 void GeoscapeState::popup(State *state)
 {
+	if (_simulation != 0)
+	{
+		// nobody answers during the headless simulation, popup applies its default answer directly
+		state->applyDefaultOutcome();
+		_simulation->addPopup();
+		delete state;
+		return;
+	}
 	_pause = true;
 	_popups.push_back(state);
 }
@@ -3685,6 +4047,17 @@ void GeoscapeState::handleBaseDefense(Base *base, Ufo *ufo)
 	}
 	else if (base->getAvailableSoldiers(true, true) > 0 || !base->getVehicles()->empty())
 	{
+		if (_simulation != 0)
+		{
+			// no battles during the headless simulation, the outcome is given by battle policy
+			_simulation->addBaseDefense();
+			if (_simulation->getBattlePolicy() == GeoscapeSimulation::BATTLES_LOSE)
+			{
+				// losing the base defense destroys the base, same as when it is undefended
+				popup(new BaseDestroyedState(base, ufo, false, false));
+			}
+			return;
+		}
 		SavedBattleGame *bgame = new SavedBattleGame(_game->getMod(), _game->getLanguage());
 		_game->getSavedGame()->setBattleGame(bgame);
 		bgame->setMissionType("STR_BASE_DEFENSE");
@@ -39,6 +39,8 @@ class MissionSite;
 class Base;
 class RuleMissionScript;
 class RuleEvent;
+class RadarSourceIndex;
+class GeoscapeSimulation;
 
 /**
  * Geoscape screen which shows an overview of
@@ -68,6 +70,7 @@ private:
 	std::vector<Craft*> _activeCrafts;
 	size_t _minimizedDogfights;
 	int _slowdownCounter;
+	GeoscapeSimulation *_simulation;
 
 	// hidden alien activity accumulators
 	std::map<OpenXcom::Region*, int> _hiddenAlienActivityRegions;
@@ -97,6 +100,12 @@ public:
 	void timeDisplay();
 	/// Advances the game timer.
 	void timeAdvance();
+	/// Skips 5 second ticks in which nothing can happen.
+	int skipQuietTicks(int limit);
+	/// Runs one game day of the headless simulation.
+	void simulateDay();
+	/// Calls off all interceptions during the headless simulation.
+	void callOffDogfights();
 	/// Trigger whenever 5 seconds pass.
 	void time5Seconds();
 	/// Trigger whenever 10 minutes pass.
@@ -105,7 +114,7 @@ public:
 	void baseHunting();
 	/// Trigger whenever 30 minutes pass.
 	void time30Minutes();
-	void ufoDetection(Ufo* ufo, const std::vector<Craft*>* activeCrafts);
+	void ufoDetection(Ufo* ufo, const std::vector<Craft*>* activeCrafts, const RadarSourceIndex& radarIndex);
 	/// Trigger whenever 1 hour passes.
 	void time1Hour();
 	/// Trigger whenever 1 day passes.
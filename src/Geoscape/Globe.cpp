@@ -17,10 +17,12 @@
  * along with OpenXcom.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "Globe.h"
+#include <algorithm>
 #include "../fmath.h"
 #include "../Engine/Action.h"
 #include "../Engine/SurfaceSet.h"
 #include "../Engine/Timer.h"
+#include "../Engine/FrameProfiler.h"
 #include "../Mod/Mod.h"
 #include "../Mod/Polygon.h"
 #include "../Mod/Polyline.h"
@@ -41,7 +43,6 @@
 #include "../Savegame/Craft.h"
 #include "../Savegame/Waypoint.h"
 #include "../Engine/ShaderMove.h"
-#include "../Engine/ShaderRepeat.h"
 #include "../Engine/Options.h"
 #include "../Savegame/MissionSite.h"
 #include "../Savegame/AlienBase.h"
@@ -53,6 +54,7 @@
 #include "../Mod/Texture.h"
 #include "../Interface/Cursor.h"
 #include "../Engine/Screen.h"
+#include "../Engine/SliceThreads.h"
 
 namespace OpenXcom
 {
@@ -309,14 +311,56 @@ struct CreateShadow
 	}
 };
 
-struct CreateShadowWithoutCache
+/// Shade cache value of pixel not covered by shading pass.
+const Uint8 ShadeNone = 0xFF;
+/// Shade cache value of pixel outside of earth disc.
+const Uint8 ShadeSpace = 0xFE;
+
+/**
+ * Calculates shade cache value of one pixel.
+ * @param earth Normal of earth surface, zero outside of disc.
+ * @param sun Sun direction.
+ * @param noise Noise of pixel.
+ */
+inline Uint8 getShadeCacheValue(const Cord& earth, const Cord& sun, Sint16 noise)
+{
+	return earth.z ? CreateShadow::getShadowValue(earth, sun, noise) : ShadeSpace;
+}
+
+/**
+ * Applies cached shade to pixel, same as CreateShadow::func.
+ * @param dest Pixel of globe.
+ * @param shade Shade cache value.
+ */
+inline void applyShadeCacheValue(Uint8& dest, Uint8 shade)
 {
-	static inline void func(Uint8& dest, const helper::Offset& offset, const Cord& sun, const Sint16& noise, const int& radius)
+	if (shade == ShadeNone)
 	{
-		Cord earth = static_data.circle_norm(0., 0., radius, offset.x, offset.y);
-		CreateShadow::func(dest, earth, sun, noise);
+		return;
 	}
-};
+	if (dest == 0 || shade == ShadeSpace)
+	{
+		dest = 0;
+	}
+	else if (CreateShadow::isOcean(dest))
+	{
+		dest = CreateShadow::getOceanShadow(shade);
+	}
+	else
+	{
+		dest = CreateShadow::getLandShadow(dest, shade);
+	}
+}
+
+/**
+ * Get pool of threads used by globe shading.
+ * Separate from scaler threads, those can be busy on present thread at same time.
+ */
+SliceThreads& getShadeThreads()
+{
+	static SliceThreads threads;
+	return threads;
+}
 
 }//namespace
 
@@ -331,7 +375,7 @@ struct CreateShadowWithoutCache
  * @param x X position in pixels.
  * @param y Y position in pixels.
  */
-Globe::Globe(Game* game, int cenX, int cenY, int width, int height, int x, int y) : InteractiveSurface(width, height, x, y), _cenX(cenX), _cenY(cenY), _rotLon(0.0), _rotLat(0.0), _hoverLon(0.0), _hoverLat(0.0), _craftLon(0.0), _craftLat(0.0), _craftRange(0.0), _game(game), _hover(false), _craft(false), _blink(-1),
+Globe::Globe(Game* game, int cenX, int cenY, int width, int height, int x, int y) : InteractiveSurface(width, height, x, y), _cenX(cenX), _cenY(cenY), _rotLon(0.0), _rotLat(0.0), _hoverLon(0.0), _hoverLat(0.0), _craftLon(0.0), _craftLat(0.0), _craftRange(0.0), _game(game), _hover(false), _craft(false), _blink(-1), _shadeCenX(0), _shadeCenY(0), _shadeZoom(0), _radarCenLon(0.0), _radarCenLat(0.0), _radarRadius(0.0), _radarCenX(0), _radarCenY(0),
 																					_isMouseScrolling(false), _isMouseScrolled(false), _xBeforeMouseScrolling(0), _yBeforeMouseScrolling(0), _lonBeforeMouseScrolling(0.0), _latBeforeMouseScrolling(0.0), _mouseScrollingStartTime(0), _totalMouseMoveX(0), _totalMouseMoveY(0), _mouseMovedOverThreshold(false)
 {
 	_rules = game->getMod()->getGlobe();
@@ -373,11 +417,6 @@ Globe::~Globe()
 	delete _texture;
 	delete _radars;
 	delete _clipper;
-
-	for (auto* polygon : _cacheLand)
-	{
-		delete polygon;
-	}
 }
 
 /**
@@ -454,46 +493,7 @@ bool Globe::pointBack(double lon, double lat) const
 
 Polygon* Globe::getPolygonFromLonLat(double lon, double lat) const
 {
-	const double zDiscard=0.75f;
-	double coslat = cos(lat);
-	double sinlat = sin(lat);
-
-	for (auto* polygon : *_rules->getPolygons())
-	{
-		double x, y, z, x2, y2;
-		double clat, clon;
-		z = 0;
-		for (int j = 0; j < polygon->getPoints(); ++j)
-		{
-			z = coslat * cos(polygon->getLatitude(j)) * cos(polygon->getLongitude(j) - lon) + sinlat * sin(polygon->getLatitude(j));
-			if (z<zDiscard) break; //discarded
-		}
-		if (z<zDiscard) continue; //discarded
-
-		bool odd = false;
-
-		clat = polygon->getLatitude(0); //initial point
-		clon = polygon->getLongitude(0);
-		x = cos(clat) * sin(clon - lon);
-		y = coslat * sin(clat) - sinlat * cos(clat) * cos(clon - lon);
-
-		for (int j = 0; j < polygon->getPoints(); ++j)
-		{
-			int k = (j + 1) % polygon->getPoints(); //index of next point in poly
-			clat = polygon->getLatitude(k);
-			clon = polygon->getLongitude(k);
-
-			x2 = cos(clat) * sin(clon - lon);
-			y2 = coslat * sin(clat) - sinlat * cos(clat) * cos(clon - lon);
-			if ( ((y>0)!=(y2>0)) && (0 < (x2-x)*(0-y)/(y2-y)+x) )
-				odd = !odd;
-			x = x2;
-			y = y2;
-
-		}
-		if (odd) return polygon;
-	}
-	return NULL;
+	return _rules->getPolygonFromLonLat(lon, lat);
 }
 
 /**
@@ -849,59 +849,70 @@ std::vector<Target*> Globe::getTargets(int x, int y, bool craft, Craft *currentC
 }
 
 /**
- * Takes care of pre-calculating all the polygons currently visible
- * on the globe and caching them so they only need to be recalculated
- * when the globe is actually moved.
+ * Caches visible land polygons and their screen coordinates.
+ * Points of all polygons are converted to unit vectors once and kept in flat arrays,
+ * every redraw projects them in one pass into reused buffers without any allocation.
  */
 void Globe::cachePolygons()
 {
-	cache(_rules->getPolygons(), &_cacheLand);
-}
+	if (_landPolygons.empty())
+	{
+		for (auto* polygon : *_rules->getPolygons())
+		{
+			_landPolygons.push_back({ (int)_landPointX.size(), polygon->getPoints(), polygon->getTexture() });
+			for (int j = 0; j < polygon->getPoints(); ++j)
+			{
+				Cord point = Cord(CordPolar(polygon->getLongitude(j), polygon->getLatitude(j)));
+				_landPointX.push_back(point.x);
+				_landPointY.push_back(point.y);
+				_landPointZ.push_back(point.z);
+			}
+		}
+		_landDepth.resize(_landPointX.size());
+		_landScreenX.resize(_landPointX.size());
+		_landScreenY.resize(_landPointX.size());
+		_landX.resize(_landPointX.size());
+		_landY.resize(_landPointX.size());
+	}
 
-/**
- * Caches a set of polygons.
- * @param polygons Pointer to list of polygons.
- * @param cache Pointer to cache.
- */
-void Globe::cache(std::list<Polygon*> *polygons, std::list<Polygon*> *cache)
-{
-	// Clear existing cache
-	for (auto* polygon : *cache)
+	// orthographic projection as in polarToCart, in terms of unit vectors:
+	// depth along view direction, screen axes along east and north of globe center
+	const Cord view = Cord(CordPolar(_cenLon, _cenLat));
+	const Cord east = Cord(cos(_cenLon), 0.0, -sin(_cenLon));
+	const Cord north = Cord(-sin(_cenLon) * sin(_cenLat), cos(_cenLat), -cos(_cenLon) * sin(_cenLat));
+	const size_t count = _landPointX.size();
+	const double *px = _landPointX.data(), *py = _landPointY.data(), *pz = _landPointZ.data();
+	double *depth = _landDepth.data(), *screenX = _landScreenX.data(), *screenY = _landScreenY.data();
+	for (size_t i = 0; i < count; ++i)
 	{
-		delete polygon;
+		depth[i] = px[i] * view.x + py[i] * view.y + pz[i] * view.z;
+		screenX[i] = _radius * (px[i] * east.x + pz[i] * east.z);
+		screenY[i] = _radius * (px[i] * north.x + py[i] * north.y + pz[i] * north.z);
 	}
-	cache->clear();
 
-	// Pre-calculate values to cache
-	for (auto* polygon : *polygons)
+	_cacheLand.clear();
+	for (size_t p = 0; p < _landPolygons.size(); ++p)
 	{
+		const auto& polygon = _landPolygons[p];
 		// Is quad on the back face?
 		double closest = 0.0;
-		double z;
 		double furthest = 0.0;
-		for (int j = 0; j < polygon->getPoints(); ++j)
+		for (int j = polygon.firstPoint; j < polygon.firstPoint + polygon.points; ++j)
 		{
-			z = cos(_cenLat) * cos(polygon->getLatitude(j)) * cos(polygon->getLongitude(j) - _cenLon) + sin(_cenLat) * sin(polygon->getLatitude(j));
-			if (z > closest)
-				closest = z;
-			else if (z < furthest)
-				furthest = z;
+			if (depth[j] > closest)
+				closest = depth[j];
+			else if (depth[j] < furthest)
+				furthest = depth[j];
 		}
 		if (-furthest > closest)
 			continue;
 
-		Polygon* p = new Polygon(*polygon);
-
-		// Convert coordinates
-		for (int j = 0; j < p->getPoints(); ++j)
+		for (int j = polygon.firstPoint; j < polygon.firstPoint + polygon.points; ++j)
 		{
-			Sint16 x, y;
-			polarToCart(p->getLongitude(j), p->getLatitude(j), &x, &y);
-			p->setX(j, x);
-			p->setY(j, y);
+			_landX[j] = _cenX + (Sint16)floor(screenX[j]);
+			_landY[j] = _cenY + (Sint16)floor(screenY[j]);
 		}
-
-		cache->push_back(p);
+		_cacheLand.push_back(p);
 	}
 }
 
@@ -960,6 +971,7 @@ void Globe::rotate()
  */
 void Globe::draw()
 {
+	FrameProfiler::Scope profile(FrameProfiler::PROFILE_GLOBE);
 	if (_redraw)
 	{
 		cachePolygons();
@@ -995,19 +1007,11 @@ void Globe::drawOcean()
  */
 void Globe::drawLand()
 {
-	Sint16 x[4], y[4];
-
-	for (auto* polygon : _cacheLand)
+	for (int p : _cacheLand)
 	{
-		// Convert coordinates
-		for (int j = 0; j < polygon->getPoints(); ++j)
-		{
-			x[j] = polygon->getX(j);
-			y[j] = polygon->getY(j);
-		}
-
+		const auto& polygon = _landPolygons[p];
 		// Apply textures according to zoom and shade
-		drawTexturedPolygon(x, y, polygon->getPoints(), _texture->getFrame(polygon->getTexture() + _zoomTexture), 0, 0);
+		drawTexturedPolygon(&_landX[polygon.firstPoint], &_landY[polygon.firstPoint], polygon.points, _texture->getFrame(polygon.texture + _zoomTexture), 0, 0);
 	}
 }
 
@@ -1067,28 +1071,78 @@ Cord Globe::getSunDirection(double lon, double lat) const
 }
 
 
+/**
+ * Shades the globe according to the position of the sun.
+ * Shade of every pixel is kept between redraws and only recalculated when the sun
+ * or the view moves, both passes split rows of the globe between threads.
+ */
 void Globe::drawShadow()
 {
-	if (Options::globeSurfaceCache)
+	const Cord sun = getSunDirection(_cenLon, _cenLat);
+	const int width = getWidth();
+	const int height = getHeight();
+	const bool useEarthData = Options::globeSurfaceCache && _zoom < _earthData.size();
+	const bool recalculate = _shadeCache.size() != (size_t)(width * height)
+		|| _shadeSun.x != sun.x || _shadeSun.y != sun.y || _shadeSun.z != sun.z
+		|| _shadeCenX != _cenX || _shadeCenY != _cenY || _shadeZoom != _zoom;
+	if (recalculate)
 	{
-		ShaderMove<Cord> earth = ShaderMove<Cord>(SurfaceRaw<Cord>(_earthData[_zoom], getWidth(), getHeight()));
-		ShaderRepeat<Sint16> noise = ShaderRepeat<Sint16>(SurfaceRaw<Sint16>(static_data.random_noise, static_data.random_surf_size, static_data.random_surf_size));
-
-		earth.setMove(_cenX-getWidth()/2, _cenY-getHeight()/2);
-
-		lock();
-		ShaderDraw<CreateShadow>(ShaderSurface(this), earth, ShaderScalar(getSunDirection(_cenLon, _cenLat)), noise);
-		unlock();
+		_shadeCache.resize(width * height);
+		_shadeSun = sun;
+		_shadeCenX = _cenX;
+		_shadeCenY = _cenY;
+		_shadeZoom = _zoom;
 	}
-	else
-	{
-		ShaderRepeat<Sint16> noise = ShaderRepeat<Sint16>(SurfaceRaw<Sint16>(static_data.random_noise, static_data.random_surf_size, static_data.random_surf_size));
 
-		lock();
-		ShaderDraw<CreateShadowWithoutCache>(ShaderSurface(this), helper::Offset(_cenX, _cenY), ShaderScalar(getSunDirection(_cenLon, _cenLat)), noise, ShaderScalar(_zoomRadius[_zoom]));
-		unlock();
-	}
+	const int moveX = _cenX - width / 2;
+	const int moveY = _cenY - height / 2;
+	const int radius = _zoomRadius[_zoom];
+	const int noiseSize = GlobeStaticData::random_surf_size;
 
+	lock();
+	getShadeThreads().forEachSlice(height,
+		[&](int begin, int end)
+		{
+			for (int y = begin; y < end; ++y)
+			{
+				Uint8* shade = &_shadeCache[y * width];
+				if (recalculate)
+				{
+					const Sint16* noise = &static_data.random_noise[(y % noiseSize) * noiseSize];
+					if (useEarthData)
+					{
+						// precalculated normals are moved with globe center, pixels outside of them are not shaded
+						const int earthY = y - moveY;
+						const int beginX = Clamp(moveX, 0, width);
+						const int endX = Clamp(moveX + width, 0, width);
+						std::fill(shade, shade + width, ShadeNone);
+						if (earthY >= 0 && earthY < height)
+						{
+							const Cord* earth = &_earthData[_zoom][earthY * width];
+							for (int x = beginX; x < endX; ++x)
+							{
+								shade[x] = getShadeCacheValue(earth[x - moveX], sun, noise[x % noiseSize]);
+							}
+						}
+					}
+					else
+					{
+						for (int x = 0; x < width; ++x)
+						{
+							const Cord earth = static_data.circle_norm(0., 0., radius, x - _cenX, y - _cenY);
+							shade[x] = getShadeCacheValue(earth, sun, noise[x % noiseSize]);
+						}
+					}
+				}
+				Uint8* dest = getRaw(0, y);
+				for (int x = 0; x < width; ++x)
+				{
+					applyShadeCacheValue(dest[x], shade[x]);
+				}
+			}
+		}
+	);
+	unlock();
 }
 
 
@@ -1172,15 +1226,15 @@ void Globe::drawRadars()
 	double lat, lon;
 	std::vector<double> ranges;
 
-	_radars->lock();
+	_radarCircles.clear();
 
 	// Draw craft range
 	if (_craft)
 	{
 		if (_craftRange < M_PI)
 		{
-			drawGlobeCircle(_craftLat, _craftLon, _craftRange, 64);
-			drawGlobeCircle(_craftLat, _craftLon, _craftRange - 0.025, 64, 2);
+			addRadarCircle(_craftLat, _craftLon, _craftRange, 64);
+			addRadarCircle(_craftLat, _craftLon, _craftRange - 0.025, 64, 2);
 		}
 	}
 
@@ -1189,7 +1243,7 @@ void Globe::drawRadars()
 		for (auto& facType : _game->getMod()->getBaseFacilitiesList())
 		{
 			range = Nautical(_game->getMod()->getBaseFacility(facType)->getRadarRange());
-			drawGlobeCircle(_hoverLat,_hoverLon,range,48);
+			addRadarCircle(_hoverLat,_hoverLon,range,48);
 			if (Options::globeAllRadarsOnBaseBuild) ranges.push_back(range);
 		}
 	}
@@ -1205,7 +1259,7 @@ void Globe::drawRadars()
 		{
 			if (_hover && Options::globeAllRadarsOnBaseBuild)
 			{
-				for (size_t j=0; j<ranges.size(); j++) drawGlobeCircle(lat,lon,ranges[j],48);
+				for (size_t j=0; j<ranges.size(); j++) addRadarCircle(lat,lon,ranges[j],48);
 			}
 			else
 			{
@@ -1220,7 +1274,7 @@ void Globe::drawRadars()
 				}
 				range = Nautical(range);
 
-				if (range>0) drawGlobeCircle(lat,lon,range,48);
+				if (range>0) addRadarCircle(lat,lon,range,48);
 			}
 
 		}
@@ -1228,13 +1282,13 @@ void Globe::drawRadars()
 		// Draw radars around player craft
 		for (auto* xcraft : *xbase->getCrafts())
 		{
-			if (xcraft->getStatus() != "STR_OUT")
+			if (xcraft->getStatus() != Craft::STATUS_OUT)
 				continue;
 			lat = xcraft->getLatitude();
 			lon = xcraft->getLongitude();
 			range = Nautical(xcraft->getCraftStats().radarRange);
 
-			if (range>0) drawGlobeCircle(lat,lon,range,24);
+			if (range>0) addRadarCircle(lat,lon,range,24);
 		}
 	}
 
@@ -1253,7 +1307,7 @@ void Globe::drawRadars()
 				lon = ufo->getLongitude();
 				range = Nautical(ufo->getCraftStats().radarRange);
 
-				if (range > 0) drawGlobeCircle(lat, lon, range, 24);
+				if (range > 0) addRadarCircle(lat, lon, range, 24);
 			}
 		}
 
@@ -1266,14 +1320,85 @@ void Globe::drawRadars()
 				lon = ab->getLongitude();
 				range = Nautical(ab->getDeployment()->getBaseDetectionRange());
 
-				if (range > 0) drawGlobeCircle(lat, lon, range, 24);
+				if (range > 0) addRadarCircle(lat, lon, range, 24);
 			}
 		}
 	}
 
+	const int width = _radars->getWidth();
+	const int height = _radars->getHeight();
+
+	_radars->lock();
+	if (isRadarCacheValid())
+	{
+		for (int y = 0; y < height; ++y)
+		{
+			std::copy_n(&_radarCache[y * width], width, _radars->getRaw(0, y));
+		}
+	}
+	else
+	{
+		for (auto& circle : _radarCircles)
+		{
+			drawGlobeCircle(circle.lat, circle.lon, circle.radius, circle.segments, circle.frac);
+		}
+		_radarCache.resize(width * height);
+		for (int y = 0; y < height; ++y)
+		{
+			std::copy_n(_radars->getRaw(0, y), width, &_radarCache[y * width]);
+		}
+		_radarCacheCircles = _radarCircles;
+		_radarCenLon = _cenLon;
+		_radarCenLat = _cenLat;
+		_radarRadius = _radius;
+		_radarCenX = _cenX;
+		_radarCenY = _cenY;
+	}
 	_radars->unlock();
 }
 
+/**
+ * Queues a globe range circle for the radar overlay.
+ * @param lat Latitude of the circle center.
+ * @param lon Longitude of the circle center.
+ * @param radius Radius of the circle in radians.
+ * @param segments Number of segments of the circle.
+ * @param frac Draw only every n-th segment.
+ */
+void Globe::addRadarCircle(double lat, double lon, double radius, int segments, int frac)
+{
+	_radarCircles.push_back(RadarCircle{ lat, lon, radius, segments, frac });
+}
+
+/**
+ * Checks if the rasterized radar overlay can be reused for this redraw.
+ * Circles that moved by less than half a pixel are considered unchanged,
+ * so slowly flying craft do not force a redraw every frame.
+ * @return True if the cached overlay matches the queued circles and the view.
+ */
+bool Globe::isRadarCacheValid() const
+{
+	if (_radarCache.size() != (size_t)(_radars->getWidth() * _radars->getHeight())
+		|| _radarCenLon != _cenLon || _radarCenLat != _cenLat || _radarRadius != _radius
+		|| _radarCenX != _cenX || _radarCenY != _cenY
+		|| _radarCacheCircles.size() != _radarCircles.size())
+	{
+		return false;
+	}
+	const double tolerance = 0.5 / _radius;
+	for (size_t i = 0; i < _radarCircles.size(); ++i)
+	{
+		const RadarCircle& now = _radarCircles[i];
+		const RadarCircle& old = _radarCacheCircles[i];
+		if (now.segments != old.segments || now.frac != old.frac || !AreSame(now.radius, old.radius)
+			|| std::abs(now.lat - old.lat) > tolerance || std::abs(now.lon - old.lon) > tolerance)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 /**
  *	Draw globe range circle
  */
@@ -1660,7 +1785,7 @@ void Globe::drawFlights()
 		for (auto* xcraft : *xbase->getCrafts())
 		{
 			// Hide crafts docked at base
-			if (xcraft->getStatus() != "STR_OUT" || xcraft->getDestination() == 0 /*|| pointBack(xcraft->getLongitude(), xcraft->getLatitude())*/)
+			if (xcraft->getStatus() != Craft::STATUS_OUT || xcraft->getDestination() == 0 /*|| pointBack(xcraft->getLongitude(), xcraft->getLatitude())*/)
 				continue;
 
 			double lon1 = xcraft->getLongitude();
@@ -2113,6 +2238,8 @@ void Globe::setupRadii(int width, int height)
 
 	_radius = _zoomRadius[_zoom];
 	_radiusStep = (_zoomRadius[DOGFIGHT_ZOOM] - _zoomRadius[0]) / 10.0;
+	_shadeCache.clear();
+	_radarCache.clear();
 
 	if (Options::globeSurfaceCache)
 	{
@@ -64,13 +64,42 @@ private:
 	bool _hover, _craft;
 	int _blink;
 	Timer *_blinkTimer, *_rotTimer;
-	std::list<Polygon*> _cacheLand;
+	/// Land polygon stored as a range of points in flat arrays.
+	struct LandPolygon
+	{
+		int firstPoint, points, texture;
+	};
+	std::vector<LandPolygon> _landPolygons;
+	/// Unit vectors of all land points, one array per component.
+	std::vector<double> _landPointX, _landPointY, _landPointZ;
+	/// Projection of all land points, reused between redraws.
+	std::vector<double> _landDepth, _landScreenX, _landScreenY;
+	std::vector<Sint16> _landX, _landY;
+	/// Indexes of land polygons facing the viewer.
+	std::vector<int> _cacheLand;
 	FastLineClip *_clipper;
 	double _radius, _radiusStep;
 	///normal of each pixel in earth globe per zoom level
 	std::vector<std::vector<Cord> > _earthData;
 	///list of dimension of earth on screen per zoom level
 	std::vector<double> _zoomRadius;
+	/// Shade of every pixel from last shading pass, reused while sun and view do not change.
+	std::vector<Uint8> _shadeCache;
+	Cord _shadeSun;
+	Sint16 _shadeCenX, _shadeCenY;
+	size_t _shadeZoom;
+	/// Radar circle queued for drawing on the globe.
+	struct RadarCircle
+	{
+		double lat, lon, radius;
+		int segments, frac;
+	};
+	/// Radar circles of the current redraw and of the last rasterized overlay.
+	std::vector<RadarCircle> _radarCircles, _radarCacheCircles;
+	/// Pixels of the last rasterized radar overlay, reused while circles and view do not change.
+	std::vector<Uint8> _radarCache;
+	double _radarCenLon, _radarCenLat, _radarRadius;
+	Sint16 _radarCenX, _radarCenY;
 
 	bool _isMouseScrolling, _isMouseScrolled;
 	int _xBeforeMouseScrolling, _yBeforeMouseScrolling;
@@ -87,10 +116,12 @@ private:
 	Polygon* getPolygonFromLonLat(double lon, double lat) const;
 	/// Checks if a target is near a point.
 	bool targetNear(Target* target, int x, int y) const;
-	/// Caches a set of polygons.
-	void cache(std::list<Polygon*> *polygons, std::list<Polygon*> *cache);
 	/// Get position of sun relative to given position in polar cords and date.
 	Cord getSunDirection(double lon, double lat) const;
+	/// Queues globe range circle for drawing.
+	void addRadarCircle(double lat, double lon, double radius, int segments, int frac = 1);
+	/// Checks if radar overlay cache still matches queued circles and view.
+	bool isRadarCacheValid() const;
 	/// Draw globe range circle.
 	void drawGlobeCircle(double lat, double lon, double radius, int segments, int frac = 1);
 	/// Special "transparent" line.
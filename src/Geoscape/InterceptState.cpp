@@ -201,10 +201,10 @@ InterceptState::InterceptState(Globe *globe, bool useCustomSound, Base *base, Ta
 		auto* xcraft = std::get<0>(tuple);
 		{
 			std::ostringstream ssStatus;
-			std::string status = xcraft->getStatus();
+			Craft::CraftStatus status = xcraft->getStatus();
 
 			bool hasEnoughPilots = xcraft->arePilotsOnboard(_game->getMod());
-			if (status == "STR_OUT")
+			if (status == Craft::STATUS_OUT)
 			{
 				// QoL: let's give the player a bit more info
 				if (xcraft->getDestination() == 0 || xcraft->getIsAutoPatrolling())
@@ -248,37 +248,37 @@ InterceptState::InterceptState(Globe *globe, bool useCustomSound, Base *base, Ta
 					}
 					else
 					{
-						ssStatus << tr(status); // "STR_OUT"
+						ssStatus << tr(xcraft->getStatusString()); // "STR_OUT"
 					}
 				}
 			}
 			else
 			{
-				if (!hasEnoughPilots && status == "STR_READY")
+				if (!hasEnoughPilots && status == Craft::STATUS_READY)
 				{
 					ssStatus << tr("STR_PILOT_MISSING");
 				}
 				else
 				{
-					ssStatus << tr(status);
+					ssStatus << tr(xcraft->getStatusString());
 				}
 			}
-			if (status != "STR_READY" && status != "STR_OUT")
+			if (status != Craft::STATUS_READY && status != Craft::STATUS_OUT)
 			{
 				unsigned int maintenanceHours = 0;
 
-				if (Options::oxceInterceptGuiMaintenanceTime == 2 || xcraft->getStatus() == "STR_REPAIRS")
+				if (Options::oxceInterceptGuiMaintenanceTime == 2 || xcraft->getStatus() == Craft::STATUS_REPAIRS)
 				{
 					maintenanceHours += xcraft->calcRepairTime();
 				}
-				if (Options::oxceInterceptGuiMaintenanceTime == 2 || xcraft->getStatus() == "STR_REFUELLING")
+				if (Options::oxceInterceptGuiMaintenanceTime == 2 || xcraft->getStatus() == Craft::STATUS_REFUELLING)
 				{
 					maintenanceHours += xcraft->calcRefuelTime();
 				}
-				if (Options::oxceInterceptGuiMaintenanceTime == 2 || xcraft->getStatus() == "STR_REARMING")
+				if (Options::oxceInterceptGuiMaintenanceTime == 2 || xcraft->getStatus() == Craft::STATUS_REARMING)
 				{
 					// Note: if the craft is already refueling, don't count any potential rearm time (can be > 0 if ammo is missing)
-					if (xcraft->getStatus() != "STR_REFUELLING")
+					if (xcraft->getStatus() != Craft::STATUS_REFUELLING)
 					{
 						maintenanceHours += xcraft->calcRearmTime();
 					}
@@ -362,7 +362,7 @@ InterceptState::InterceptState(Globe *globe, bool useCustomSound, Base *base, Ta
 			}
 			_crafts.push_back(xcraft);
 			_lstCrafts->addRow(4, xcraft->getName(_game->getLanguage()).c_str(), ssStatus.str().c_str(), xbase->getName().c_str(), ss.str().c_str());
-			if (hasEnoughPilots && status == "STR_READY")
+			if (hasEnoughPilots && status == Craft::STATUS_READY)
 			{
 				_lstCrafts->setCellColor(row, 1, _lstCrafts->getSecondaryColor());
 			}
@@ -376,7 +376,7 @@ InterceptState::InterceptState(Globe *globe, bool useCustomSound, Base *base, Ta
 				}
 				else
 				{
-					bool craftAvailable = Options::craftLaunchAlways || status == "STR_READY" || status == "STR_OUT";
+					bool craftAvailable = Options::craftLaunchAlways || status == Craft::STATUS_READY || status == Craft::STATUS_OUT;
 					if (craftAvailable)
 					{
 						double craftDistanceToTarget = std::get<1>(tuple);
@@ -430,8 +430,8 @@ void InterceptState::lstCraftsLeftClick(Action *)
 	// condition used in shift and non-shift paths
 	auto allowStart = [&](Craft* c)
 	{
-		return c->getStatus() == "STR_READY" || (
-			 (c->getStatus() == "STR_OUT" || Options::craftLaunchAlways) &&
+		return c->getStatus() == Craft::STATUS_READY || (
+			 (c->getStatus() == Craft::STATUS_OUT || Options::craftLaunchAlways) &&
 			 !c->getLowFuel() &&
 			 !c->getMissionComplete() );
 	};
@@ -492,7 +492,7 @@ void InterceptState::lstCraftsLeftClick(Action *)
 void InterceptState::lstCraftsRightClick(Action *)
 {
 	Craft* c = _crafts[_lstCrafts->getSelectedRow()];
-	if (c->getStatus() == "STR_OUT")
+	if (c->getStatus() == Craft::STATUS_OUT)
 	{
 		_globe->center(c->getLongitude(), c->getLatitude());
 		_game->popState();
@@ -345,21 +345,7 @@ void MonthlyReportState::btnOkClick(Action*)
 	if (!_gameOver)
 	{
 		_game->popState();
-		// Award medals for service time
-		// Iterate through all your bases
-		for (auto* xbase : *_game->getSavedGame()->getBases())
-		{
-			// Iterate through all your soldiers
-			for (auto* soldier : *xbase->getSoldiers())
-			{
-				// Award medals to eligible soldiers
-				soldier->getDiary()->addMonthlyService();
-				if (soldier->getDiary()->manageCommendations(_game->getMod(), _game->getSavedGame()->getMissionStatistics()))
-				{
-					_soldiersMedalled.push_back(soldier);
-				}
-			}
-		}
+		awardServiceMedals();
 		if (!_soldiersMedalled.empty())
 		{
 			_game->pushState(new CommendationState(_soldiersMedalled));
@@ -390,12 +376,7 @@ void MonthlyReportState::btnOkClick(Action*)
 		{
 			_game->popState(); // in case the cutscene is not marked as "game over" (by accident or not) let's return to the geoscape
 
-			std::string cutsceneId;
-			if (_gameOver == 1)
-				cutsceneId = _game->getMod()->getLoseRatingCutscene();
-			else
-				cutsceneId = _game->getMod()->getLoseMoneyCutscene();
-
+			const std::string &cutsceneId = getGameOverCutscene();
 			const RuleVideo* videoRule = _game->getMod()->getVideo(cutsceneId, true);
 			if (videoRule->getLoseGame())
 			{
@@ -427,6 +408,57 @@ void MonthlyReportState::btnOkClick(Action*)
 	}
 }
 
+/**
+ * Applies results of the report without showing it: soldiers get their
+ * monthly service, or the game ends if the failure cutscene says so.
+ * Psi training and saves need the player and are left out.
+ */
+void MonthlyReportState::applyDefaultOutcome()
+{
+	if (!_gameOver)
+	{
+		awardServiceMedals();
+	}
+	else if (_game->getMod()->getVideo(getGameOverCutscene(), true)->getLoseGame())
+	{
+		_game->getSavedGame()->setEnding(END_LOSE);
+	}
+}
+
+/**
+ * Adds monthly service to all soldiers and awards medals to eligible ones.
+ */
+void MonthlyReportState::awardServiceMedals()
+{
+	// Iterate through all your bases
+	for (auto* xbase : *_game->getSavedGame()->getBases())
+	{
+		// Iterate through all your soldiers
+		for (auto* soldier : *xbase->getSoldiers())
+		{
+			// Award medals to eligible soldiers
+			soldier->getDiary()->addMonthlyService();
+			if (soldier->getDiary()->manageCommendations(_game->getMod(), _game->getSavedGame()->getMissionStatistics()))
+			{
+				_soldiersMedalled.push_back(soldier);
+			}
+		}
+	}
+}
+
+/**
+ * Gets the cutscene shown when the player failed this month.
+ * @return Cutscene ID.
+ */
+const std::string &MonthlyReportState::getGameOverCutscene() const
+{
+	if (_gameOver == 1)
+	{
+		return _game->getMod()->getLoseRatingCutscene();
+	}
+	return _game->getMod()->getLoseMoneyCutscene();
+}
+
 /**
  * Update all our activity counters, gather all our scores,
  * get our countries to make sign pacts, adjust their fundings,
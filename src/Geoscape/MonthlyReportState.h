@@ -50,6 +50,10 @@ private:
 	std::vector<Soldier*> _soldiersMedalled;
 	/// Builds a country list string.
 	std::string countryList(const std::vector<std::string> &countries, const std::string &singular, const std::string &plural);
+	/// Adds monthly service to soldiers and awards medals.
+	void awardServiceMedals();
+	/// Gets the cutscene shown when the game is over.
+	const std::string &getGameOverCutscene() const;
 public:
 	/// Creates the Monthly Report state.
 	MonthlyReportState(Globe *globe);
@@ -59,6 +63,8 @@ public:
 	void btnOkClick(Action *action);
 	/// Calculate monthly scores.
 	void calculateChanges();
+	/// Applies results of the report without showing it.
+	void applyDefaultOutcome() override;
 };
 
 }
@@ -167,7 +167,7 @@ SelectDestinationState::SelectDestinationState(std::vector<Craft*> crafts, Globe
 		}
 	}
 
-	if (_crafts.front()->getStatus() != "STR_OUT")
+	if (_crafts.front()->getStatus() != Craft::STATUS_OUT)
 	{
 		_globe->setCraftRange(_crafts.front()->getLongitude(), _crafts.front()->getLatitude(), _crafts.front()->getBaseRange());
 		_globe->invalidate();
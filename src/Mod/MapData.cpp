@@ -73,6 +73,22 @@ void MapData::setSprite(int frameID, int value)
 	_sprite[frameID] = value;
 }
 
+/**
+ * Gets whether the sprite changes between animation frames.
+ * @return True if any frame uses a different sprite index than the first one.
+ */
+bool MapData::isAnimated() const
+{
+	for (int i = 1; i < 8; ++i)
+	{
+		if (_sprite[i] != _sprite[0])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
 /**
  * Gets whether this is an animated ufo door.
  * @return True if this is an animated ufo door.
@@ -73,6 +73,8 @@ public:
 	int getSprite(int frameID) const;
 	/// Sets the sprite index for a certain frame.
 	void setSprite(int frameID, int value);
+	/// Gets whether the sprite changes between animation frames.
+	bool isAnimated() const;
 	/// Gets whether this is an animated ufo door.
 	bool isUFODoor() const;
 	/// Gets whether this is a floor.
@@ -30,6 +30,19 @@
 namespace OpenXcom
 {
 
+namespace
+{
+
+/**
+ * Dot product of two vectors.
+ */
+inline double dotProduct(const Cord& a, const Cord& b)
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+} //namespace
+
 /**
  * Creates a blank ruleset for globe contents.
  */
@@ -139,6 +152,149 @@ void RuleGlobe::load(const YAML::YamlNodeReader& reader)
 	reader.tryRead("oceanShading", Globe::OCEAN_SHADING);
 }
 
+/**
+ * Builds grid of polygons used by point location. Every polygon caches unit vectors
+ * of its points and a bounding cap, and is stored in all grid cells its cap touches,
+ * in the same order as in the polygon list.
+ */
+void RuleGlobe::afterLoad(const Mod*)
+{
+	const double cellSize = 2 * M_PI / PolygonGridColumns;
+
+	_indexedPolygons.clear();
+	_indexedPolygons.reserve(_polygons.size());
+	for (auto* polygon : _polygons)
+	{
+		IndexedPolygon indexed;
+		indexed.polygon = polygon;
+		indexed.minDot = -1.0;
+		for (int j = 0; j < polygon->getPoints(); ++j)
+		{
+			indexed.points.push_back(Cord(CordPolar(polygon->getLongitude(j), polygon->getLatitude(j))));
+			indexed.center += indexed.points.back();
+		}
+		const double norm = indexed.center.norm();
+		if (norm > 1e-6)
+		{
+			indexed.center /= norm;
+			double radius = 0.0;
+			for (auto& point : indexed.points)
+			{
+				radius = std::max(radius, acos(Clamp(dotProduct(point, indexed.center), -1.0, 1.0)));
+			}
+			// point inside polygon is inside its bounding cap only when cap is smaller than a hemisphere
+			if (radius + 1e-6 < M_PI_2)
+			{
+				indexed.minDot = cos(radius + 1e-6);
+			}
+		}
+		_indexedPolygons.push_back(indexed);
+	}
+
+	_polygonGrid.assign(PolygonGridRows * PolygonGridColumns, std::vector<int>());
+	for (int row = 0; row < PolygonGridRows; ++row)
+	{
+		const double lat0 = -M_PI_2 + row * cellSize;
+		for (int column = 0; column < PolygonGridColumns; ++column)
+		{
+			const double lon0 = column * cellSize;
+			const Cord cellCenter = Cord(CordPolar(lon0 + cellSize / 2, lat0 + cellSize / 2));
+			// farthest point of cell from its center is one of corners or middles of edges
+			double cellRadius = 0.0;
+			for (int i = 0; i <= 2; ++i)
+			{
+				for (int j = 0; j <= 2; ++j)
+				{
+					const Cord p = Cord(CordPolar(lon0 + i * cellSize / 2, lat0 + j * cellSize / 2));
+					cellRadius = std::max(cellRadius, acos(Clamp(dotProduct(p, cellCenter), -1.0, 1.0)));
+				}
+			}
+			cellRadius += 0.001;
+
+			auto& cell = _polygonGrid[row * PolygonGridColumns + column];
+			for (size_t i = 0; i < _indexedPolygons.size(); ++i)
+			{
+				const auto& indexed = _indexedPolygons[i];
+				if (indexed.minDot <= -1.0 || acos(Clamp(dotProduct(indexed.center, cellCenter), -1.0, 1.0)) <= acos(indexed.minDot) + cellRadius)
+				{
+					cell.push_back(i);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Returns the first polygon containing a point. Only polygons from grid cell of the point are checked,
+ * each of them first against its bounding cap and then by the ray-crossing test in the plane tangent to the point.
+ * @param lon Longitude of the point.
+ * @param lat Latitude of the point.
+ * @return Pointer to the polygon, or NULL if the point is not inside any polygon.
+ */
+Polygon *RuleGlobe::getPolygonFromLonLat(double lon, double lat) const
+{
+	const double zDiscard = 0.75f;
+	const double cellSize = 2 * M_PI / PolygonGridColumns;
+	if (_polygonGrid.empty())
+	{
+		return nullptr;
+	}
+
+	const Cord point = Cord(CordPolar(lon, lat));
+	const Cord east = Cord(cos(lon), 0.0, -sin(lon));
+	const Cord north = Cord(-sin(lon) * sin(lat), cos(lat), -cos(lon) * sin(lat));
+
+	double normLon = fmod(lon, 2 * M_PI);
+	if (normLon < 0)
+	{
+		normLon += 2 * M_PI;
+	}
+	const int row = Clamp((int)((lat + M_PI_2) / cellSize), 0, PolygonGridRows - 1);
+	const int column = Clamp((int)(normLon / cellSize), 0, PolygonGridColumns - 1);
+
+	for (int i : _polygonGrid[row * PolygonGridColumns + column])
+	{
+		const auto& indexed = _indexedPolygons[i];
+		if (dotProduct(point, indexed.center) < indexed.minDot)
+		{
+			continue;
+		}
+
+		bool discarded = indexed.points.empty();
+		for (auto& p : indexed.points)
+		{
+			if (dotProduct(point, p) < zDiscard)
+			{
+				discarded = true;
+				break;
+			}
+		}
+		if (discarded)
+		{
+			continue;
+		}
+
+		bool odd = false;
+		double x = dotProduct(indexed.points[0], east);
+		double y = dotProduct(indexed.points[0], north);
+		for (size_t j = 0; j < indexed.points.size(); ++j)
+		{
+			const auto& next = indexed.points[(j + 1) % indexed.points.size()];
+			double x2 = dotProduct(next, east);
+			double y2 = dotProduct(next, north);
+			if ( ((y>0)!=(y2>0)) && (0 < (x2-x)*(0-y)/(y2-y)+x) )
+				odd = !odd;
+			x = x2;
+			y = y2;
+		}
+		if (odd)
+		{
+			return indexed.polygon;
+		}
+	}
+	return nullptr;
+}
+
 /**
  * Returns the list of polygons in the globe.
  * @return Pointer to the list of polygons.
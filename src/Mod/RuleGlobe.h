@@ -19,7 +19,9 @@
  */
 #include <list>
 #include <string>
+#include <vector>
 #include "../Engine/Yaml.h"
+#include "../Geoscape/Cord.h"
 
 namespace OpenXcom
 {
@@ -27,6 +29,7 @@ namespace OpenXcom
 class Polygon;
 class Polyline;
 class Texture;
+class Mod;
 
 /**
  * Represents the contents of the Geoscape globe,
@@ -39,6 +42,20 @@ private:
 	std::list<Polygon*> _polygons;
 	std::list<Polyline*> _polylines;
 	std::map<int, Texture*> _textures;
+
+	/// Polygon with cached unit vectors of its points and bounding cap, used for point location.
+	struct IndexedPolygon
+	{
+		Polygon *polygon;
+		std::vector<Cord> points;
+		Cord center;
+		double minDot;
+	};
+	/// Size of polygon grid, every cell is 5 degrees wide and tall.
+	static constexpr int PolygonGridRows = 36, PolygonGridColumns = 72;
+
+	std::vector<IndexedPolygon> _indexedPolygons;
+	std::vector<std::vector<int>> _polygonGrid;
 public:
 	/// Creates a blank globe ruleset.
 	RuleGlobe();
@@ -46,6 +63,10 @@ public:
 	~RuleGlobe();
 	/// Loads the globe from YAML.
 	void load(const YAML::YamlNodeReader& reader);
+	/// Builds spatial index of polygons after all mods are loaded.
+	void afterLoad(const Mod* mod);
+	/// Gets the polygon containing a point.
+	Polygon *getPolygonFromLonLat(double lon, double lat) const;
 	/// Gets the list of world polygons.
 	std::list<Polygon*> *getPolygons();
 	/// Gets the list of world polylines.
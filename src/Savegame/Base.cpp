@@ -588,7 +588,7 @@ int Base::getAvailableSoldiers(bool checkCombatReadiness, bool includeWounded) c
 		{
 			total++;
 		}
-		else if (checkCombatReadiness && ((soldier->getCraft() != 0 && soldier->getCraft()->getStatus() != "STR_OUT") ||
+		else if (checkCombatReadiness && ((soldier->getCraft() != 0 && soldier->getCraft()->getStatus() != Craft::STATUS_OUT) ||
 			(soldier->getCraft() == 0 && (soldier->hasFullHealth() || (includeWounded && soldier->canDefendBase())))))
 		{
 			total++;
@@ -1377,7 +1377,7 @@ int Base::getCraftCountForProduction(const RuleCraft *craft) const
 	int total = 0;
 	for (const auto* xcraft : _crafts)
 	{
-		if (xcraft->getRules() == craft && xcraft->getStatus() != "STR_OUT")
+		if (xcraft->getRules() == craft && xcraft->getStatus() != Craft::STATUS_OUT)
 		{
 			total++;
 		}
@@ -1820,7 +1820,7 @@ void Base::setupDefenses(AlienMission* am)
 	// add vehicles that are in the crafts of the base, if it's not out
 	for (auto* xcraft : _crafts)
 	{
-		if (xcraft->getStatus() != "STR_OUT")
+		if (xcraft->getStatus() != Craft::STATUS_OUT)
 		{
 			for (auto* vehicle : *xcraft->getVehicles())
 			{
@@ -2583,6 +2583,57 @@ void BattleUnit::clearVisibleUnits()
 	_visibleUnits.clear();
 }
 
+namespace
+{
+
+/**
+ * Checks if tile is marked in a tile bitset.
+ * @param lookup Bitset indexed by tile index.
+ * @param tile Tile to check.
+ * @return true if marked.
+ */
+bool hasTileInLookup(const std::vector<bool> &lookup, const Tile *tile)
+{
+	const size_t index = tile->getIndex();
+	return index < lookup.size() && lookup[index];
+}
+
+/**
+ * Marks tile in a tile bitset, the bitset grows to cover whole battle map if needed.
+ * @param lookup Bitset indexed by tile index.
+ * @param tile Tile to mark.
+ * @return true if tile was not marked before.
+ */
+bool addTileToLookup(std::vector<bool> &lookup, const Tile *tile)
+{
+	const size_t index = tile->getIndex();
+	if (index >= lookup.size())
+	{
+		lookup.resize(tile->getSavedGame()->getMapSizeXYZ(), false);
+	}
+	if (lookup[index])
+	{
+		return false;
+	}
+	lookup[index] = true;
+	return true;
+}
+
+/**
+ * Unmarks all given tiles in a tile bitset, cost depends only on number of tiles, not map size.
+ * @param lookup Bitset indexed by tile index.
+ * @param tiles Tiles that were marked.
+ */
+void clearTilesInLookup(std::vector<bool> &lookup, const std::vector<Tile *> &tiles)
+{
+	for (auto* tile : tiles)
+	{
+		lookup[tile->getIndex()] = false;
+	}
+}
+
+} //namespace
+
 /**
  * Add this unit to the list of visible tiles.
  * @param tile that we're now able to see.
@@ -2592,16 +2643,27 @@ bool BattleUnit::addToVisibleTiles(Tile *tile)
 {
 	tile->setLastExplored(getFaction());
 	//Only add once, otherwise we're going to mess up the visibility value and make trouble for the AI (if sneaky).
-	if (_visibleTilesLookup.insert(tile).second)
+	if (addTileToLookup(_visibleTilesLookup, tile))
 	{
 		if (getFaction() == FACTION_PLAYER)
 			tile->setVisible(1);
+		tile->getSavedGame()->addFactionVisibleTile(getFaction(), tile);
 		_visibleTiles.push_back(tile);
 		return true;
 	}
 	return false;
 }
 
+/**
+ * Has this unit marked this tile as within its view?
+ * @param tile Tile to check.
+ * @return true if tile is in visible tiles.
+ */
+bool BattleUnit::hasVisibleTile(const Tile *tile) const
+{
+	return hasTileInLookup(_visibleTilesLookup, tile);
+}
+
 /**
  * Get the pointer to the vector of visible tiles.
  * @return pointer to vector.
@@ -2618,7 +2680,7 @@ const std::vector<Tile*> *BattleUnit::getVisibleTiles()
  */
 bool BattleUnit::addToLofTiles(Tile *tile)
 {
-	if (_lofTilesLookup.insert(tile).second)
+	if (addTileToLookup(_lofTilesLookup, tile))
 	{
 		_lofTiles.push_back(tile);
 		return true;
@@ -2626,6 +2688,16 @@ bool BattleUnit::addToLofTiles(Tile *tile)
 	return false;
 }
 
+/**
+ * Has this unit marked this tile as within its lof?
+ * @param tile Tile to check.
+ * @return true if tile is in lof tiles.
+ */
+bool BattleUnit::hasLofTile(const Tile *tile) const
+{
+	return hasTileInLookup(_lofTilesLookup, tile);
+}
+
 /**
  * Add this tile to the list of no lof tiles.
  * @param tile that we don't have a lof to.
@@ -2633,7 +2705,7 @@ bool BattleUnit::addToLofTiles(Tile *tile)
  */
 bool BattleUnit::addToNoLofTiles(Tile *tile)
 {
-	if (_noLofTilesLookup.insert(tile).second)
+	if (addTileToLookup(_noLofTilesLookup, tile))
 	{
 		_noLofTiles.push_back(tile);
 		return true;
@@ -2641,6 +2713,16 @@ bool BattleUnit::addToNoLofTiles(Tile *tile)
 	return false;
 }
 
+/**
+ * Has this unit marked this tile as without its lof?
+ * @param tile Tile to check.
+ * @return true if tile is in no lof tiles.
+ */
+bool BattleUnit::hasNoLofTile(const Tile *tile) const
+{
+	return hasTileInLookup(_noLofTilesLookup, tile);
+}
+
 /**
  * Get the pointer to the vector of lof tiles.
  * @return pointer to vector.
@@ -2667,8 +2749,9 @@ void BattleUnit::clearVisibleTiles()
 	for (auto* tile : _visibleTiles)
 	{
 		tile->setVisible(-1);
+		tile->getSavedGame()->removeFactionVisibleTile(getFaction(), tile);
 	}
-	_visibleTilesLookup.clear();
+	clearTilesInLookup(_visibleTilesLookup, _visibleTiles);
 	_visibleTiles.clear();
 	clearLofTiles();
 }
@@ -2678,10 +2761,28 @@ void BattleUnit::clearVisibleTiles()
  */
 void BattleUnit::clearLofTiles()
 {
-	_lofTilesLookup.clear();
+	clearTilesInLookup(_lofTilesLookup, _lofTiles);
 	_lofTiles.clear();
+	clearTilesInLookup(_noLofTilesLookup, _noLofTiles);
 	_noLofTiles.clear();
-	_noLofTilesLookup.clear();
+}
+
+/**
+ * Moves visible tiles of this unit from the current faction visibility to the new one.
+ * Need to be called before the faction changes.
+ * @param faction New faction of the unit.
+ */
+void BattleUnit::moveVisibleTilesToFaction(UnitFaction faction)
+{
+	if (faction == _faction)
+	{
+		return;
+	}
+	for (auto* tile : _visibleTiles)
+	{
+		tile->getSavedGame()->removeFactionVisibleTile(_faction, tile);
+		tile->getSavedGame()->addFactionVisibleTile(faction, tile);
+	}
 }
 
 /**
@@ -3036,6 +3137,7 @@ void BattleUnit::prepareNewTurn(bool fullProcess)
 	// because it's no longer a unit of the team getting TUs back
 	if (_faction != _originalFaction)
 	{
+		moveVisibleTilesToFaction(_originalFaction);
 		_faction = _originalFaction;
 		if (_faction == FACTION_PLAYER && _currentAIState)
 		{
@@ -4992,6 +5094,7 @@ const std::string& BattleUnit::getType() const
  */
 void BattleUnit::convertToFaction(UnitFaction f)
 {
+	moveVisibleTilesToFaction(f);
 	_faction = f;
 }
 
@@ -93,9 +93,9 @@ private:
 	std::vector<Tile *> _visibleTiles;
 	std::vector<Tile *> _lofTiles;
 	std::vector<Tile *> _noLofTiles;
-	std::unordered_set<Tile *> _visibleTilesLookup;
-	std::unordered_set<Tile *> _lofTilesLookup;
-	std::unordered_set<Tile *> _noLofTilesLookup;
+	std::vector<bool> _visibleTilesLookup;
+	std::vector<bool> _lofTilesLookup;
+	std::vector<bool> _noLofTilesLookup;
 	int _tu, _energy, _health, _morale, _stunlevel, _mana;
 	bool _kneeled, _floating, _dontReselect, _aiMedikitUsed;
 	bool _haveNoFloorBelow = false;
@@ -216,6 +216,8 @@ private:
 	void prepareBannedFlag(const RuleStartingCondition* sc);
 	/// Applies percentual and/or flat adjustments to the use costs.
 	void applyPercentages(RuleItemUseCost &cost, const RuleItemUseFlat &flat) const;
+	/// Helper function moving visible tiles to the faction counters of a new faction.
+	void moveVisibleTilesToFaction(UnitFaction faction);
 public:
 	static const int MAX_SOLDIER_ID = 1000000;
 	static const int BUBBLES_FIRST_FRAME = 3;
@@ -395,20 +397,11 @@ public:
 	/// Add tile to units no-lof-tiles
 	bool addToNoLofTiles(Tile *tile);
 	/// Has this unit marked this tile as within its view?
-	bool hasVisibleTile(Tile *tile) const
-	{
-		return _visibleTilesLookup.find(tile) != _visibleTilesLookup.end(); //find?
-	}
+	bool hasVisibleTile(const Tile *tile) const;
 	/// Has this unit marked this tile as within its lof?
-	bool hasLofTile(Tile *tile) const
-	{
-		return _lofTilesLookup.find(tile) != _lofTilesLookup.end(); // find?
-	}
-	/// Has this unit marked this tile as within its lof?
-	bool hasNoLofTile(Tile *tile) const
-	{
-		return _noLofTilesLookup.find(tile) != _noLofTilesLookup.end(); // find?
-	}
+	bool hasLofTile(const Tile *tile) const;
+	/// Has this unit marked this tile as without its lof?
+	bool hasNoLofTile(const Tile *tile) const;
 	/// Get the list of visible tiles.
 	const std::vector<Tile*> *getVisibleTiles();
 	/// Get the list of lof tiles.
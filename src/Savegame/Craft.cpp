@@ -49,6 +49,14 @@
 namespace OpenXcom
 {
 
+const char *Craft::STATUS_STRING[] = {
+	"STR_READY",
+	"STR_OUT",
+	"STR_REPAIRS",
+	"STR_REFUELLING",
+	"STR_REARMING"
+};
+
 /**
  * Initializes a craft of the specified type and
  * assigns it the latest craft ID available.
@@ -59,7 +67,7 @@ namespace OpenXcom
 Craft::Craft(const RuleCraft *rules, Base *base, int id) : MovingTarget(),
 	_rules(rules), _base(base), _fuel(0), _excessFuel(0), _damage(0), _shield(0),
 	_interceptionOrder(0), _takeoff(0), _weapons(),
-	_status("STR_READY"), _lowFuel(false), _mission(false),
+	_status(STATUS_READY), _lowFuel(false), _mission(false),
 	_inBattlescape(false), _inDogfight(false), _stats(),
 	_isAutoPatrolling(false), _assignedToSlot(false), 
 	_lonAuto(0.0), _latAuto(0.0), _skinIndex(0), _baseEscapePosition(-1,-1,-1)
@@ -192,7 +200,20 @@ void Craft::load(const YAML::YamlNodeReader& node, const ScriptGlobal *shared, c
 			Log(LOG_ERROR) << "Failed to load vehicles item " << type;
 		}
 	}
-	reader.tryRead("status", _status);
+	std::string status;
+	if (reader.tryRead("status", status))
+	{
+		auto it = std::find(std::begin(STATUS_STRING), std::end(STATUS_STRING), status);
+		if (it != std::end(STATUS_STRING))
+		{
+			_status = (CraftStatus)(it - std::begin(STATUS_STRING));
+		}
+		else
+		{
+			Log(LOG_ERROR) << "Failed to load craft status " << status;
+			_status = STATUS_READY;
+		}
+	}
 	reader.tryRead("lowFuel", _lowFuel);
 	reader.tryRead("mission", _mission);
 	reader.tryRead("interceptionOrder", _interceptionOrder);
@@ -361,7 +382,7 @@ void Craft::save(YAML::YamlNodeWriter writer, const ScriptGlobal *shared) const
 	writer.write("vehicles", _vehicles,
 		[](YAML::YamlNodeWriter& vectorWriter, Vehicle* v)
 		{ v->save(vectorWriter.write()); });
-	writer.write("status", _status);
+	writer.write("status", STATUS_STRING[_status]);
 	if (_lowFuel)
 		writer.write("lowFuel", _lowFuel);
 	if (_mission)
@@ -449,7 +470,7 @@ std::string Craft::getDefaultName(Language *lang) const
  */
 int Craft::getMarker() const
 {
-	if (_status != "STR_OUT")
+	if (_status != STATUS_OUT)
 		return -1;
 	else if (_rules->getMarker() == -1)
 		return 1;
@@ -482,18 +503,27 @@ void Craft::setBase(Base *base, bool move)
 
 /**
  * Returns the current status of the craft.
- * @return Status string.
+ * @return Status.
  */
-std::string Craft::getStatus() const
+Craft::CraftStatus Craft::getStatus() const
 {
 	return _status;
 }
 
+/**
+ * Returns the current status of the craft as translatable string.
+ * @return Status string.
+ */
+const char *Craft::getStatusString() const
+{
+	return STATUS_STRING[_status];
+}
+
 /**
  * Changes the current status of the craft.
- * @param status Status string.
+ * @param status Status.
  */
-void Craft::setStatus(const std::string &status)
+void Craft::setStatus(CraftStatus status)
 {
 	_status = status;
 }
@@ -522,7 +552,7 @@ std::string Craft::getAltitude() const
  */
 void Craft::setDestination(Target *dest)
 {
-	if (_status != "STR_OUT")
+	if (_status != STATUS_OUT)
 	{
 		_takeoff = 60;
 	}
@@ -1137,6 +1167,16 @@ bool Craft::isTakingOff() const
 	return _takeoff == 60;
 }
 
+/**
+ * Is the craft standing still with no destination and no takeoff in progress?
+ * Such craft don't change in 5 second game ticks.
+ * @return True if craft is idle.
+ */
+bool Craft::isIdle() const
+{
+	return _dest == 0 && _takeoff == 0;
+}
+
 /**
  * Checks the condition of all the craft's systems
  * to define its new status (eg. when arriving at base).
@@ -1161,19 +1201,19 @@ void Craft::checkup()
 
 	if (_damage > 0)
 	{
-		_status = "STR_REPAIRS";
+		_status = STATUS_REPAIRS;
 	}
 	else if (available != full)
 	{
-		_status = "STR_REARMING";
+		_status = STATUS_REARMING;
 	}
 	else if (_fuel < _stats.fuelMax)
 	{
-		_status = "STR_REFUELLING";
+		_status = STATUS_REFUELLING;
 	}
 	else
 	{
-		_status = "STR_READY";
+		_status = STATUS_READY;
 	}
 }
 
@@ -1293,7 +1333,7 @@ void Craft::repair()
 	setDamage(_damage - _rules->getRepairRate());
 	if (_damage <= 0)
 	{
-		_status = "STR_REARMING";
+		_status = STATUS_REARMING;
 	}
 }
 
@@ -1325,7 +1365,7 @@ std::string Craft::refuel()
 				fuel = item->getType();
 				if (_fuel > 0)
 				{
-					_status = "STR_READY";
+					_status = STATUS_READY;
 				}
 				else
 				{
@@ -1336,12 +1376,12 @@ std::string Craft::refuel()
 	}
 	if (_fuel >= _stats.fuelMax)
 	{
-		_status = "STR_READY";
+		_status = STATUS_READY;
 		for (const auto* cw : _weapons)
 		{
 			if (cw && cw->isRearming())
 			{
-				_status = "STR_REARMING";
+				_status = STATUS_REARMING;
 				break;
 			}
 		}
@@ -1362,7 +1402,7 @@ const RuleItem* Craft::rearm()
 	{
 		if (iter == _weapons.end())
 		{
-			_status = "STR_REFUELLING";
+			_status = STATUS_REFUELLING;
 			break;
 		}
 		CraftWeapon* cw = (*iter);
@@ -1884,7 +1924,7 @@ void Craft::reuseItem(const RuleItem* item)
 	// (And we don't want to interrupt any out-of-base status.)
 
 	// The only states we are willing to interrupt are "ready" and "refuelling"
-	if (_status != "STR_READY" && _status != "STR_REFUELLING")
+	if (_status != STATUS_READY && _status != STATUS_REFUELLING)
 	{
 		return;
 	}
@@ -1895,17 +1935,17 @@ void Craft::reuseItem(const RuleItem* item)
 		if (cw != 0 && item == cw->getRules()->getClipItem() && cw->getAmmo() < cw->getRules()->getAmmoMax() && !cw->isDisabled())
 		{
 			cw->setRearming(true);
-			_status = "STR_REARMING";
+			_status = STATUS_REARMING;
 		}
 	}
 
 	// Only consider refuelling if everything else is complete
-	if (_status != "STR_READY")
+	if (_status != STATUS_READY)
 		return;
 
 	// Check if it's fuel to refuel the craft
 	if (item == _rules->getRefuelItem() && _fuel < _stats.fuelMax)
-		_status = "STR_REFUELLING";
+		_status = STATUS_REFUELLING;
 }
 
 /**
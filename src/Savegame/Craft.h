@@ -86,6 +86,9 @@ public:
 	/// Register all useful function used by script.
 	static void ScriptRegister(ScriptParserBase* parser);
 
+	/// Status strings used in saves and shown to the player, in order of CraftStatus.
+	static const char *STATUS_STRING[];
+	enum CraftStatus { STATUS_READY, STATUS_OUT, STATUS_REPAIRS, STATUS_REFUELLING, STATUS_REARMING };
 
 private:
 	const RuleCraft *_rules;
@@ -96,7 +99,7 @@ private:
 	ItemContainer *_tempSoldierItems;
 	ItemContainer *_tempExtraItems;
 	std::vector<Vehicle*> _vehicles;
-	std::string _status;
+	CraftStatus _status;
 	bool _lowFuel, _mission, _inBattlescape, _inDogfight;
 	double _speedMaxRadian;
 	RuleCraftStats _stats;
@@ -145,9 +148,11 @@ public:
 	/// Sets the craft's base.
 	void setBase(Base *base, bool move = true);
 	/// Gets the craft's status.
-	std::string getStatus() const;
+	CraftStatus getStatus() const;
+	/// Gets the craft's status as translatable string.
+	const char *getStatusString() const;
 	/// Sets the craft's status.
-	void setStatus(const std::string &status);
+	void setStatus(CraftStatus status);
 	/// Gets the craft's altitude.
 	std::string getAltitude() const;
 	/// Sets the craft's destination.
@@ -264,6 +269,8 @@ public:
 	bool think();
 	/// Is the craft about to take off?
 	bool isTakingOff() const;
+	/// Is the craft standing still with no destination and no takeoff in progress?
+	bool isIdle() const;
 	/// Does a craft full checkup.
 	void checkup();
 	/// Consumes the craft's fuel.
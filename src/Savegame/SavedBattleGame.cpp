@@ -660,6 +660,13 @@ void SavedBattleGame::initMap(int mapsize_x, int mapsize_y, int mapsize_z, bool
 	{
 		_tiles.push_back(Tile(getTileCoords(i), this));
 	}
+	for (auto& visibleTiles : _factionVisibleTiles)
+	{
+		visibleTiles.assign(_tiles.size(), 0);
+	}
+	_tilesOnFire.clear();
+	_tilesWithSmoke.clear();
+	_dangerousTiles.clear();
 
 }
 
@@ -1620,10 +1627,11 @@ void SavedBattleGame::endTurn()
 	}
 
 	//danger state must be cleared after each player due to autoplay also setting it
-	for (int i = 0; i < _mapsize_x * _mapsize_y * _mapsize_z; ++i)
+	for (auto* tile : _dangerousTiles)
 	{
-		getTile(i)->setDangerous(false);
+		tile->setDangerous(false);
 	}
+	_dangerousTiles.clear();
 
 	//scripts update
 	newTurnUpdateScripts();
@@ -2398,17 +2406,8 @@ Node *SavedBattleGame::getPatrolNode(bool scout, BattleUnit *unit, Node *fromNod
  */
 void SavedBattleGame::prepareNewTurn()
 {
-	std::vector<Tile*> tilesOnFire;
-	std::vector<Tile*> tilesOnSmoke;
-
 	// prepare a list of tiles on fire
-	for (int i = 0; i < _mapsize_x * _mapsize_y * _mapsize_z; ++i)
-	{
-		if (getTile(i)->getFire() > 0)
-		{
-			tilesOnFire.push_back(getTile(i));
-		}
-	}
+	std::vector<Tile*> tilesOnFire = getTilesOnFire();
 
 	// first: fires spread
 	for (auto* tileOnFire : tilesOnFire)
@@ -2471,14 +2470,13 @@ void SavedBattleGame::prepareNewTurn()
 	}
 
 	// prepare a list of tiles on fire/with smoke in them (smoke acts as fire intensity)
-	for (int i = 0; i < _mapsize_x * _mapsize_y * _mapsize_z; ++i)
+	std::vector<Tile*> tilesOnSmoke = getTilesWithSmoke();
+
+	for (auto* tile : _dangerousTiles)
 	{
-		if (getTile(i)->getSmoke() > 0)
-		{
-			tilesOnSmoke.push_back(getTile(i));
-		}
-		getTile(i)->setDangerous(false);
+		tile->setDangerous(false);
 	}
+	_dangerousTiles.clear();
 
 	// now make the smoke spread.
 	for (auto* tileOnSmoke : tilesOnSmoke)
@@ -2535,10 +2533,9 @@ void SavedBattleGame::prepareNewTurn()
 	if (!tilesOnFire.empty() || !tilesOnSmoke.empty())
 	{
 		// do damage to units, average out the smoke, etc.
-		for (int i = 0; i < _mapsize_x * _mapsize_y * _mapsize_z; ++i)
+		for (auto* tile : getTilesWithSmoke())
 		{
-			if (getTile(i)->getSmoke() != 0)
-				getTile(i)->prepareNewTurn(getDepth() == 0);
+			tile->prepareNewTurn(getDepth() == 0);
 		}
 	}
 
@@ -2551,6 +2548,54 @@ void SavedBattleGame::prepareNewTurn()
 	//fov and light udadates are done in `BattlescapeGame::endTurn`
 }
 
+namespace
+{
+
+/**
+ * Removes tiles that no longer match given condition and sorts rest by tile index.
+ * @param tiles List of tracked tiles.
+ * @param isActive Check if tile should stay on list.
+ * @param untrack Callback clearing tile tracking flag.
+ */
+template<typename IsActive, typename Untrack>
+void updateTrackedTiles(std::vector<Tile*>& tiles, IsActive isActive, Untrack untrack)
+{
+	Collections::removeIf(tiles,
+		[&](Tile* tile)
+		{
+			if (isActive(tile))
+			{
+				return false;
+			}
+			untrack(tile);
+			return true;
+		}
+	);
+	std::sort(tiles.begin(), tiles.end(), [](const Tile* a, const Tile* b) { return a->getIndex() < b->getIndex(); });
+}
+
+} //namespace
+
+/**
+ * Gets all burning tiles, cost depends on number of burning tiles not size of map.
+ * @return Tiles ordered by tile index.
+ */
+const std::vector<Tile*>& SavedBattleGame::getTilesOnFire()
+{
+	updateTrackedTiles(_tilesOnFire, [](Tile* tile) { return tile->getFire() > 0; }, [](Tile* tile) { tile->untrackFire(); });
+	return _tilesOnFire;
+}
+
+/**
+ * Gets all tiles with smoke, cost depends on number of smoking tiles not size of map.
+ * @return Tiles ordered by tile index.
+ */
+const std::vector<Tile*>& SavedBattleGame::getTilesWithSmoke()
+{
+	updateTrackedTiles(_tilesWithSmoke, [](Tile* tile) { return tile->getSmoke() > 0; }, [](Tile* tile) { tile->untrackSmoke(); });
+	return _tilesWithSmoke;
+}
+
 /**
  * Checks for units that are unconscious and revives them if they shouldn't be.
  *
@@ -3739,27 +3784,35 @@ void SavedBattleGame::ScriptRegister(ScriptParserBase* parser)
 	sbg.addCustomConst("DIFF_SUPERHUMAN", DIFF_SUPERHUMAN);
 }
 
-/*
-* Used for FOW updates
-* Called in BattleGame popState and init, and when unit is moving in map.cpp
-*/
-void SavedBattleGame::updateVisibleTiles()
+/**
+ * Marks a tile as seen by one more unit of the given faction.
+ * Called by units when they add the tile to their visible tiles.
+ * @param faction Faction of the observing unit.
+ * @param tile Tile that is now visible.
+ */
+void SavedBattleGame::addFactionVisibleTile(UnitFaction faction, const Tile* tile)
 {
-	_currentlyVisibleTiles.clear();
-	for (BattleUnit* unit : _units)
-	{
-		if (unit->getFaction() == FACTION_PLAYER)
-			_currentlyVisibleTiles.insert(unit->getVisibleTiles()->begin(), unit->getVisibleTiles()->end());
-	}
+	++_factionVisibleTiles[faction][tile->getIndex()];
 }
 
-/*
-*
-* Returns true if tile is visible to player
-*/
-bool SavedBattleGame::isTileVisible(Tile* sometile)
+/**
+ * Marks a tile as seen by one less unit of the given faction.
+ * Called by units when they clear their visible tiles.
+ * @param faction Faction of the observing unit.
+ * @param tile Tile that is no longer visible by that unit.
+ */
+void SavedBattleGame::removeFactionVisibleTile(UnitFaction faction, const Tile* tile)
 {
-	return (_currentlyVisibleTiles.find(sometile) != _currentlyVisibleTiles.end());
+	auto& count = _factionVisibleTiles[faction][tile->getIndex()];
+	assert(count > 0 && "Tile removed more often than added!");
+	if (count > 0)
+	{
+		--count;
+	}
+	else
+	{
+		Log(LOG_ERROR) << "Visible tile counter underflow for faction " << faction << " at tile " << tile->getPosition();
+	}
 }
 
 /**
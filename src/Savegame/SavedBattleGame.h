@@ -77,6 +77,7 @@ private:
 	int _mapsize_x, _mapsize_y, _mapsize_z;
 	std::vector<MapDataSet*> _mapDataSets;
 	std::vector<Tile> _tiles;
+	std::vector<Tile*> _tilesOnFire, _tilesWithSmoke, _dangerousTiles;
 	BattleUnit *_selectedUnit, *_undoUnit, *_lastSelectedUnit;
 	std::vector<Node*> _nodes;
 	std::vector<BattleUnit*> _units;
@@ -131,7 +132,7 @@ private:
 	std::string _hiddenMovementBackground;
 	HitLog *_hitLog;
 	ScriptValues<SavedBattleGame> _scriptValues;
-	std::unordered_set<Tile*> _currentlyVisibleTiles;
+	std::vector<Uint16> _factionVisibleTiles[FACTION_MAX];
 	/// Selects a soldier.
 	BattleUnit *selectPlayerUnit(int dir, bool checkReselect = false, bool setReselect = false, bool checkInventory = false);
 	/// Run newTurnUnit and newTurnItem scripts
@@ -475,6 +476,16 @@ public:
 	Node *getPatrolNode(bool scout, BattleUnit *unit, Node *fromNode);
 	/// Carries out new turn preparations.
 	void prepareNewTurn();
+	/// Registers tile that started burning.
+	void addTileOnFire(Tile* tile) { _tilesOnFire.push_back(tile); }
+	/// Registers tile that started smoking.
+	void addTileWithSmoke(Tile* tile) { _tilesWithSmoke.push_back(tile); }
+	/// Registers tile that was marked as dangerous.
+	void addDangerousTile(Tile* tile) { _dangerousTiles.push_back(tile); }
+	/// Gets all burning tiles, ordered by tile index.
+	const std::vector<Tile*>& getTilesOnFire();
+	/// Gets all tiles with smoke (this include burning tiles), ordered by tile index.
+	const std::vector<Tile*>& getTilesWithSmoke();
 	/// Revives unconscious units (health check).
 	void reviveUnconsciousUnits(bool noTU = false);
 	/// Removes the body item that corresponds to the unit.
@@ -670,11 +681,15 @@ public:
 	void resetUnitHitStates();
 
 
-	/// used for FOW updates
-	/// called in BattleGame popState and init, and when unit is moving in map.cpp
-	void updateVisibleTiles();
-	/// Returns if tile is visible to player
-	bool isTileVisible(Tile* sometile);
+	/// Marks a tile as seen by one more unit of the given faction.
+	void addFactionVisibleTile(UnitFaction faction, const Tile* tile);
+	/// Marks a tile as seen by one less unit of the given faction.
+	void removeFactionVisibleTile(UnitFaction faction, const Tile* tile);
+	/// Returns if tile is visible to any unit of the given faction (used for FOW).
+	bool isTileVisible(const Tile* sometile, UnitFaction faction = FACTION_PLAYER) const
+	{
+		return _factionVisibleTiles[faction][sometile->getIndex()] != 0;
+	}
 	/// Returns if the map has objectives that need to be destroyed
 	bool hasObjectives();
 	/// Returns if the map has an exit-zone
@@ -53,7 +53,7 @@ namespace OpenXcom
  * constructor
  * @param pos Position.
  */
-Tile::Tile(Position pos, SavedBattleGame* save): _save(save), _pos(pos)
+Tile::Tile(Position pos, SavedBattleGame* save): _save(save), _pos(pos), _index(save->getTileIndex(pos))
 {
 	for (int i = 0; i < O_MAX; ++i)
 	{
@@ -119,6 +119,7 @@ void Tile::load(const YAML::YamlNodeReader& reader)
 	if (_fire || _smoke)
 	{
 		_animationOffset = RNG::seedless(0, 3);
+		updateFireAndSmokeTracking();
 	}
 }
 
@@ -156,6 +157,7 @@ void Tile::loadBinary(Uint8 *buffer, Tile::SerializationKey& serKey)
 	if (_fire || _smoke)
 	{
 		_animationOffset = RNG::seedless(0, 3);
+		updateFireAndSmokeTracking();
 	}
 }
 
@@ -701,6 +703,7 @@ void Tile::ignite(int power)
 				_overlaps = 1;
 				_fire = getFuel() + 1;
 				_animationOffset = RNG::generate(0,3);
+				updateFireAndSmokeTracking();
 			}
 		}
 	}
@@ -780,6 +783,7 @@ void Tile::setFire(int fire)
 {
 	_fire = Clamp(fire, 0, 255);
 	_animationOffset = RNG::generate(0,3);
+	updateFireAndSmokeTracking();
 }
 
 /**
@@ -809,6 +813,7 @@ void Tile::addSmoke(int smoke)
 		}
 		_animationOffset = RNG::generate(0,3);
 		addOverlap();
+		updateFireAndSmokeTracking();
 	}
 }
 
@@ -820,6 +825,25 @@ void Tile::setSmoke(int smoke)
 {
 	_smoke = Clamp(smoke, 0, 255);
 	_animationOffset = RNG::generate(0,3);
+	updateFireAndSmokeTracking();
+}
+
+/**
+ * Registers tile in battle lists of burning or smoking tiles when it starts burning or smoking.
+ * Tiles are removed from these lists lazily by SavedBattleGame when fire or smoke is gone.
+ */
+void Tile::updateFireAndSmokeTracking()
+{
+	if (_fire && !_cache.trackedFire)
+	{
+		_cache.trackedFire = 1;
+		_save->addTileOnFire(this);
+	}
+	if (_smoke && !_cache.trackedSmoke)
+	{
+		_cache.trackedSmoke = 1;
+		_save->addTileWithSmoke(this);
+	}
 }
 
 
@@ -1085,6 +1109,10 @@ void Tile::addOverlap()
  */
 void Tile::setDangerous(bool danger)
 {
+	if (danger && !_cache.danger)
+	{
+		_save->addDangerousTile(this);
+	}
 	_cache.danger = danger;
 }
 
@@ -109,6 +109,8 @@ public:
 		Uint8 isLadderOnWest:1;
 		Uint8 bigWall:1;
 		Uint8 danger:1;
+		Uint8 trackedFire:1;
+		Uint8 trackedSmoke:1;
 	};
 
 protected:
@@ -121,6 +123,7 @@ protected:
 	TileObjectCache _objectsCache[O_MAX] = { };
 	TileCache _cache = { };
 	Position _pos;
+	int _index;
 	Uint8 _light[LL_MAX];
 	Uint8 _fire = 0;
 	Uint8 _smoke = 0;
@@ -138,6 +141,8 @@ protected:
 	int _lastExploredByHostile = 0;
 	int _lastExploredByNeutral = 0;
 
+	/// Registers tile in battle lists of burning or smoking tiles.
+	void updateFireAndSmokeTracking();
 
 public:
 	/// Creates a tile.
@@ -237,6 +242,15 @@ public:
 		return _pos;
 	}
 
+	/**
+	 * Gets the tile's index in the battle map, same as `SavedBattleGame::getTileIndex(getPosition())`.
+	 * @return index
+	 */
+	int getIndex() const
+	{
+		return _index;
+	}
+
 	/// Gets the floor object footstep sound.
 	int getFootstepSound(Tile *tileBelow) const;
 	/// Open a door, returns the ID, 0(normal), 1(ufo) or -1 if no door opened.
@@ -412,6 +426,10 @@ public:
 	void addOverlap();
 	/// set the danger flag on this tile (so the AI will avoid it).
 	void setDangerous(bool danger);
+	/// Marks tile as no longer registered in battle list of burning tiles.
+	void untrackFire() { _cache.trackedFire = 0; }
+	/// Marks tile as no longer registered in battle list of smoking tiles.
+	void untrackSmoke() { _cache.trackedSmoke = 0; }
 	/// check the danger flag on this tile.
 	bool getDangerous() const;
 